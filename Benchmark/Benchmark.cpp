@@ -0,0 +1,446 @@
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <queue>
+#include <stack>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../DataStructure/Vector/Vector.hpp"
+#include "../DataStructure/Deque/Deque.hpp"
+#include "../DataStructure/List/List.hpp"
+#include "../DataStructure/List/UnrolledList.hpp"
+#include "../DataStructure/ForwardList/ForwardList.hpp"
+#include "../DataStructure/Stack/Stack.hpp"
+#include "../DataStructure/Queue/Queue.hpp"
+
+namespace {
+    using Benchmark::sizeType;
+    using Benchmark::State;
+    using Benchmark::doNotOptimize;
+
+    /*
+     * The non-trivial element, it has to be copied, moved and destroyed by its own functions. The string is kept
+     * in the short string buffer, so ten million elements still fit in memory.
+     */
+    struct Text {
+        std::string value;
+    };
+    template <typename T>
+    T make(sizeType);
+    template <>
+    inline int make<int>(sizeType i) {
+        return static_cast<int>(i);
+    }
+    template <>
+    inline Text make<Text>(sizeType i) {
+        return Text {std::string(15, static_cast<char>('a' + i % 26))};
+    }
+    inline sizeType weight(int value) noexcept {
+        return static_cast<sizeType>(value);
+    }
+    inline sizeType weight(const Text &value) noexcept {
+        return value.value.size();
+    }
+    inline bool less(int lhs, int rhs) noexcept {
+        return lhs < rhs;
+    }
+    inline bool less(const Text &lhs, const Text &rhs) noexcept {
+        return lhs.value < rhs.value;
+    }
+
+    template <typename Container, typename = void>
+    struct IsStandard : std::false_type {};
+    template <typename Container>
+    struct IsStandard<Container, std::void_t<typename Container::value_type>> : std::true_type {};
+    template <typename Container, bool = IsStandard<Container>::value>
+    struct ValueType {
+        using type = typename Container::valueType;
+    };
+    template <typename Container>
+    struct ValueType<Container, true> {
+        using type = typename Container::value_type;
+    };
+    template <typename>
+    struct IsStandardVector : std::false_type {};
+    template <typename T, typename Alloc>
+    struct IsStandardVector<std::vector<T, Alloc>> : std::true_type {};
+    template <typename>
+    struct IsForward : std::false_type {};
+    template <typename T, typename Alloc>
+    struct IsForward<std::forward_list<T, Alloc>> : std::true_type {};
+    template <typename T, typename Alloc>
+    struct IsForward<DataStructure::ForwardList<T, Alloc>> : std::true_type {};
+
+    template <typename Container, typename T>
+    inline void pushBack(Container &c, const T &value) {
+        if constexpr(IsStandard<Container>::value) {
+            c.push_back(value);
+        }else {
+            c.pushBack(value);
+        }
+    }
+    template <typename Container, typename T>
+    inline void pushFront(Container &c, const T &value) {
+        if constexpr(IsStandardVector<Container>::value) {
+            c.insert(c.begin(), value);
+        }else if constexpr(IsStandard<Container>::value) {
+            c.push_front(value);
+        }else {
+            c.pushFront(value);
+        }
+    }
+    /*
+     * Forward lists insert after the element at the index, the others insert before it.
+     */
+    template <typename Container, typename T>
+    inline void insert(Container &c, sizeType index, const T &value) {
+        if constexpr(IsStandard<Container>::value and IsForward<Container>::value) {
+            c.insert_after(std::next(c.begin(), static_cast<long>(index)), value);
+        }else if constexpr(IsStandard<Container>::value) {
+            c.insert(std::next(c.begin(), static_cast<long>(index)), value);
+        }else if constexpr(IsForward<Container>::value) {
+            c.insertAfter(static_cast<long>(index), value);
+        }else {
+            c.insert(static_cast<long>(index), value);
+        }
+    }
+    template <typename Container>
+    inline void erase(Container &c, sizeType index) {
+        if constexpr(IsStandard<Container>::value and IsForward<Container>::value) {
+            c.erase_after(std::next(c.begin(), static_cast<long>(index)));
+        }else if constexpr(IsStandard<Container>::value) {
+            c.erase(std::next(c.begin(), static_cast<long>(index)));
+        }else if constexpr(IsForward<Container>::value) {
+            c.eraseAfter(static_cast<long>(index));
+        }else {
+            c.erase(static_cast<long>(index));
+        }
+    }
+    template <typename Container>
+    Container fill(sizeType size) {
+        using valueType = typename ValueType<Container>::type;
+        Container c;
+        for(sizeType i {0}; i < size; ++i) {
+            if constexpr(IsForward<Container>::value) {
+                pushFront(c, make<valueType>(i));
+            }else {
+                pushBack(c, make<valueType>(i));
+            }
+        }
+        return c;
+    }
+
+    template <typename Container>
+    void pushBackBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<typename ValueType<Container>::type>(size)};
+        while(state.keepRunning()) {
+            Container c;
+            for(sizeType i {0}; i < size; ++i) {
+                pushBack(c, value);
+            }
+            doNotOptimize(c);
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+    template <typename Container>
+    void pushFrontBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<typename ValueType<Container>::type>(size)};
+        while(state.keepRunning()) {
+            Container c;
+            for(sizeType i {0}; i < size; ++i) {
+                pushFront(c, value);
+            }
+            doNotOptimize(c);
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+    template <typename Container>
+    void insertBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<typename ValueType<Container>::type>(size)};
+        auto c {fill<Container>(size)};
+        while(state.keepRunning()) {
+            insert(c, size / 2, value);
+            state.pauseTiming();
+            erase(c, size / 2);
+        }
+        doNotOptimize(c);
+    }
+    template <typename Container>
+    void eraseBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<typename ValueType<Container>::type>(size)};
+        auto c {fill<Container>(size)};
+        while(state.keepRunning()) {
+            erase(c, size / 2);
+            state.pauseTiming();
+            insert(c, size / 2, value);
+        }
+        doNotOptimize(c);
+    }
+    template <typename Container>
+    void iterateBenchmark(State &state) {
+        const auto c {fill<Container>(state.range())};
+        while(state.keepRunning()) {
+            sizeType sum {0};
+            for(const auto &value : c) {
+                sum += weight(value);
+            }
+            doNotOptimize(sum);
+        }
+        state.setItemsProcessed(state.range());
+    }
+    template <typename Container>
+    void copyBenchmark(State &state) {
+        const auto c {fill<Container>(state.range())};
+        while(state.keepRunning()) {
+            Container copy(c);
+            doNotOptimize(copy);
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(state.range());
+    }
+    template <typename Container>
+    void moveBenchmark(State &state) {
+        auto c {fill<Container>(state.range())};
+        while(state.keepRunning()) {
+            Container moved(std::move(c));
+            doNotOptimize(moved);
+            c = std::move(moved);
+        }
+        doNotOptimize(c);
+    }
+    /*
+     * Appends the elements in batches taken from a plain array, std counterpart inserts the range at the end.
+     */
+    template <typename Container>
+    void appendRangeBenchmark(State &state) {
+        using valueType = typename ValueType<Container>::type;
+        const auto size {state.range()};
+        const std::vector<valueType> batch(size < 4096 ? size : 4096, make<valueType>(size));
+        while(state.keepRunning()) {
+            Container c;
+            for(sizeType i {0}; i < size; i += batch.size()) {
+                const auto last {batch.data() + (size - i < batch.size() ? size - i : batch.size())};
+                if constexpr(IsStandard<Container>::value) {
+                    c.insert(c.end(), batch.data(), last);
+                }else {
+                    c.appendRange(batch.data(), last);
+                }
+            }
+            doNotOptimize(c);
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+    /*
+     * Sorts a copy of a scrambled list by its member function sort, making the copy isn't timed.
+     */
+    template <typename Container>
+    void sortBenchmark(State &state) {
+        using valueType = typename ValueType<Container>::type;
+        const auto size {state.range()};
+        Container scrambled;
+        for(sizeType i {0}; i < size; ++i) {
+            pushFront(scrambled, make<valueType>(i * 2654435761UL % size));
+        }
+        const auto compare {[](const valueType &lhs, const valueType &rhs) noexcept -> bool {
+            return less(lhs, rhs);
+        }};
+        while(state.keepRunning()) {
+            state.pauseTiming();
+            Container c(scrambled);
+            state.resumeTiming();
+            c.sort(compare);
+            doNotOptimize(c);
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+
+    template <typename Stack>
+    void stackBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<typename ValueType<Stack>::type>(size)};
+        while(state.keepRunning()) {
+            Stack s;
+            for(sizeType i {0}; i < size; ++i) {
+                s.push(value);
+            }
+            while(not s.empty()) {
+                doNotOptimize(s.top());
+                s.pop();
+            }
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+    /*
+     * Pushes half of the elements into each side, std counterpart is two stacks.
+     */
+    template <typename T>
+    void bilateralStackBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<T>(size)};
+        while(state.keepRunning()) {
+            DataStructure::Stack<T, T *, true> s;
+            for(sizeType i {0}; i < size; i += 2) {
+                s.pushFront(value);
+                s.pushBack(value);
+            }
+            while(not s.frontEmpty()) {
+                s.popFront();
+            }
+            while(not s.backEmpty()) {
+                s.popBack();
+            }
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+    template <typename T>
+    void standardBilateralStackBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<T>(size)};
+        while(state.keepRunning()) {
+            std::stack<T, std::vector<T>> front, back;
+            for(sizeType i {0}; i < size; i += 2) {
+                front.push(value);
+                back.push(value);
+            }
+            while(not front.empty()) {
+                front.pop();
+            }
+            while(not back.empty()) {
+                back.pop();
+            }
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+    template <typename Queue, bool Bounded>
+    inline Queue makeQueue(sizeType size) {
+        if constexpr(Bounded) {
+            return Queue(size);
+        }else {
+            return Queue();
+        }
+    }
+    template <typename Queue, bool Bounded>
+    void queueBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<typename ValueType<Queue>::type>(size)};
+        while(state.keepRunning()) {
+            auto c {makeQueue<Queue, Bounded>(size)};
+            for(sizeType i {0}; i < size; ++i) {
+                c.push(value);
+            }
+            while(not c.empty()) {
+                doNotOptimize(c.front());
+                c.pop();
+            }
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+    /*
+     * The concurrent queues can neither be copied nor be moved, and the multi-producer one has no front.
+     */
+    template <typename Queue>
+    void concurrentQueueBenchmark(State &state) {
+        const auto size {state.range()};
+        const auto value {make<typename ValueType<Queue>::type>(size)};
+        while(state.keepRunning()) {
+            Queue c(size);
+            for(sizeType i {0}; i < size; ++i) {
+                c.tryPush(value);
+            }
+            auto result {value};
+            while(c.tryPop(result)) {
+                doNotOptimize(result);
+            }
+            state.pauseTiming();
+        }
+        state.setItemsProcessed(size);
+    }
+
+    const std::vector<sizeType> allSizes {16, 256, 4096, 65536, 1048576, 10000000};
+    const std::vector<sizeType> quadraticSizes {16, 256, 4096, 65536};
+
+    template <typename DataStructureContainer, typename StandardContainer>
+    void addSequence(const std::string &name, const std::vector<sizeType> &frontSizes) {
+        using Benchmark::Registry;
+        if constexpr(not IsForward<StandardContainer>::value) {
+            Registry<>::add(name + "/pushBack", pushBackBenchmark<DataStructureContainer>,
+                    pushBackBenchmark<StandardContainer>, allSizes);
+        }
+        Registry<>::add(name + "/pushFront", pushFrontBenchmark<DataStructureContainer>,
+                pushFrontBenchmark<StandardContainer>, frontSizes);
+        Registry<>::add(name + "/insert", insertBenchmark<DataStructureContainer>,
+                insertBenchmark<StandardContainer>, allSizes);
+        Registry<>::add(name + "/erase", eraseBenchmark<DataStructureContainer>,
+                eraseBenchmark<StandardContainer>, allSizes);
+        Registry<>::add(name + "/iterate", iterateBenchmark<DataStructureContainer>,
+                iterateBenchmark<StandardContainer>, allSizes);
+        Registry<>::add(name + "/copy", copyBenchmark<DataStructureContainer>,
+                copyBenchmark<StandardContainer>, allSizes);
+        Registry<>::add(name + "/move", moveBenchmark<DataStructureContainer>,
+                moveBenchmark<StandardContainer>, allSizes);
+    }
+    template <typename T>
+    void addElement(const std::string &element) {
+        using Benchmark::Registry;
+        addSequence<DataStructure::Vector<T>, std::vector<T>>("Vector<" + element + ">", quadraticSizes);
+        addSequence<DataStructure::List<T>, std::list<T>>("List<" + element + ">", allSizes);
+        addSequence<DataStructure::ForwardList<T>, std::forward_list<T>>("ForwardList<" + element + ">", allSizes);
+        Registry<>::add("List<" + element + ">/sort", sortBenchmark<DataStructure::List<T>>,
+                sortBenchmark<std::list<T>>, allSizes);
+        Registry<>::add("ForwardList<" + element + ">/sort", sortBenchmark<DataStructure::ForwardList<T>>,
+                sortBenchmark<std::forward_list<T>>, allSizes);
+        addSequence<DataStructure::UnrolledList<T>, std::list<T>>("UnrolledList<" + element + ">", allSizes);
+        Registry<>::add("UnrolledList<" + element + "> against List/pushBack",
+                pushBackBenchmark<DataStructure::UnrolledList<T>>, pushBackBenchmark<DataStructure::List<T>>, allSizes);
+        Registry<>::add("UnrolledList<" + element + "> against List/iterate",
+                iterateBenchmark<DataStructure::UnrolledList<T>>, iterateBenchmark<DataStructure::List<T>>, allSizes);
+        Registry<>::add("UnrolledList<" + element + "> against List/copy",
+                copyBenchmark<DataStructure::UnrolledList<T>>, copyBenchmark<DataStructure::List<T>>, allSizes);
+        addSequence<DataStructure::Deque<T>, std::deque<T>>("Deque<" + element + ">", allSizes);
+        Registry<>::add("Deque<" + element + ">/appendRange", appendRangeBenchmark<DataStructure::Deque<T>>,
+                appendRangeBenchmark<std::deque<T>>, allSizes);
+        Registry<>::add("Stack<" + element + ", " + element + " *, false>/pushPop",
+                stackBenchmark<DataStructure::Stack<T, T *, false>>, stackBenchmark<std::stack<T, std::vector<T>>>,
+                allSizes);
+        Registry<>::add("Stack<" + element + ", " + element + " *, true>/pushPop",
+                bilateralStackBenchmark<T>, standardBilateralStackBenchmark<T>, allSizes);
+        Registry<>::add("Queue<" + element + ">/pushPop", queueBenchmark<DataStructure::Queue<T>, false>,
+                queueBenchmark<std::queue<T>, false>, allSizes);
+        Registry<>::add("Queue<" + element + ", " + element + " *, false, false>/pushPop",
+                queueBenchmark<DataStructure::Queue<T, T *, false, false>, false>,
+                queueBenchmark<std::queue<T>, false>, allSizes);
+        Registry<>::add("Queue<" + element + ", " + element + " *, true, false>/pushPop",
+                queueBenchmark<DataStructure::Queue<T, T *, true, false>, true>,
+                queueBenchmark<std::queue<T>, false>, allSizes);
+        Registry<>::add("Queue<" + element + ", " + element + " *, false, true>/pushPop",
+                queueBenchmark<DataStructure::Queue<T, T *, false, true>, true>,
+                queueBenchmark<std::queue<T>, false>, allSizes);
+        Registry<>::add("Queue<" + element + ", SingleProducerSingleConsumer>/pushPop",
+                concurrentQueueBenchmark<DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>>,
+                queueBenchmark<std::queue<T>, false>, allSizes);
+        Registry<>::add("Queue<" + element + ", MultiProducerMultiConsumer>/pushPop",
+                concurrentQueueBenchmark<DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>>,
+                queueBenchmark<std::queue<T>, false>, allSizes);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    addElement<int>("int");
+    addElement<Text>("Text");
+    return Benchmark::Registry<>::run(argc, argv);
+}
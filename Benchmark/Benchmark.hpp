@@ -0,0 +1,146 @@
+#ifndef DATA_STRUCTURE_BENCHMARK_HPP
+#define DATA_STRUCTURE_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace Benchmark {
+    using sizeType = unsigned long;
+    template <typename T>
+    inline void doNotOptimize(const T &value) noexcept {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+    class State final {
+    private:
+        using clock = std::chrono::steady_clock;
+    private:
+        const sizeType size;
+        const std::chrono::duration<double> minTime;
+        sizeType iterations;
+        sizeType items;
+        clock::duration elapsed;
+        clock::time_point first;
+        clock::time_point start;
+        bool running;
+    public:
+        State(sizeType, double) noexcept;
+        State(const State &) = delete;
+        State &operator=(const State &) = delete;
+        ~State() = default;
+    public:
+        sizeType range() const noexcept;
+        bool keepRunning() noexcept;
+        void pauseTiming() noexcept;
+        void resumeTiming() noexcept;
+        void setItemsProcessed(sizeType) noexcept;
+        double nanosecondsPerItem() const noexcept;
+    };
+    using function = void (*)(State &);
+    struct Comparison {
+        std::string name;
+        function dataStructure;
+        function standard;
+        std::vector<sizeType> sizes;
+    };
+    template <typename = void>
+    class Registry final {
+    private:
+        static std::vector<Comparison> comparisons;
+    private:
+        static double measure(function, sizeType, double);
+    public:
+        static void add(const std::string &, function, function, std::vector<sizeType>);
+        static int run(int, char *[]);
+    };
+}
+
+inline Benchmark::State::State(sizeType size, double minTime) noexcept : size {size}, minTime {minTime},
+        iterations {0}, items {1}, elapsed {clock::duration::zero()}, first {clock::now()}, start {this->first},
+        running {false} {}
+inline Benchmark::sizeType Benchmark::State::range() const noexcept {
+    return this->size;
+}
+inline bool Benchmark::State::keepRunning() noexcept {
+    const auto now {clock::now()};
+    if(this->running) {
+        this->elapsed += now - this->start;
+        this->running = false;
+    }
+    if(this->iterations and (this->elapsed >= this->minTime or now - this->first >= this->minTime * 10)) {
+        return false;
+    }
+    ++this->iterations;
+    this->running = true;
+    this->start = clock::now();
+    return true;
+}
+inline void Benchmark::State::pauseTiming() noexcept {
+    this->elapsed += clock::now() - this->start;
+    this->running = false;
+}
+inline void Benchmark::State::resumeTiming() noexcept {
+    this->running = true;
+    this->start = clock::now();
+}
+inline void Benchmark::State::setItemsProcessed(sizeType items) noexcept {
+    this->items = items ? items : 1;
+}
+inline double Benchmark::State::nanosecondsPerItem() const noexcept {
+    return std::chrono::duration<double, std::nano>(this->elapsed).count() /
+            static_cast<double>(this->iterations * this->items);
+}
+
+template <typename Tag>
+std::vector<Benchmark::Comparison> Benchmark::Registry<Tag>::comparisons {};
+template <typename Tag>
+double Benchmark::Registry<Tag>::measure(function benchmark, sizeType size, double minTime) {
+    State state(size, minTime);
+    benchmark(state);
+    return state.nanosecondsPerItem();
+}
+template <typename Tag>
+void Benchmark::Registry<Tag>::add(const std::string &name, function dataStructure, function standard,
+        std::vector<sizeType> sizes) {
+    comparisons.push_back(Comparison {name, dataStructure, standard, std::move(sizes)});
+}
+template <typename Tag>
+int Benchmark::Registry<Tag>::run(int argc, char *argv[]) {
+    const char *filter {""};
+    sizeType maxSize {10000000};
+    double minTime {0.1};
+    for(auto i {1}; i < argc; ++i) {
+        if(not std::strncmp(argv[i], "--filter=", 9)) {
+            filter = argv[i] + 9;
+        }else if(not std::strncmp(argv[i], "--max-size=", 11)) {
+            maxSize = std::strtoul(argv[i] + 11, nullptr, 10);
+        }else if(not std::strncmp(argv[i], "--min-time=", 11)) {
+            minTime = std::strtod(argv[i] + 11, nullptr);
+        }else {
+            std::fprintf(stderr, "usage : %s [--filter=substring] [--max-size=n] [--min-time=seconds]\n", argv[0]);
+            return 1;
+        }
+    }
+    std::printf("%-52s %10s %16s %16s %8s\n", "Benchmark", "Size", "DataStructure", "std", "Ratio");
+    for(const auto &comparison : comparisons) {
+        if(comparison.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        for(auto size : comparison.sizes) {
+            if(size > maxSize) {
+                continue;
+            }
+            const auto dataStructure {measure(comparison.dataStructure, size, minTime)};
+            const auto standard {measure(comparison.standard, size, minTime)};
+            std::printf("%-52s %10lu %13.2f ns %13.2f ns %8.2f\n", comparison.name.c_str(), size,
+                    dataStructure, standard, dataStructure / standard);
+            std::fflush(stdout);
+        }
+    }
+    return 0;
+}
+
+#endif //DATA_STRUCTURE_BENCHMARK_HPP
@@ -1,10 +1,81 @@
 #ifndef DATA_STRUCTURE_ALLOCATOR_HPP
 #define DATA_STRUCTURE_ALLOCATOR_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
 #include "Exception.hpp"
+#include "Statistics.hpp"
 #include "TypeTraits.hpp"
 
+#if defined(LARGE_ALLOCATION_DATA_STRUCTURE) and defined(__linux__)
+#define __DATA_STRUCTURE_LARGE_ALLOCATION
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace DataStructure {
+    template <typename = void>
+    class __DataStructure_MemoryPool final {
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+    private:
+        union node {
+            node *next;
+            char data[1];
+        };
+    public:
+        enum : sizeType {
+            align = 8,
+            maxBytes = 128,
+            freeListNumber = maxBytes / align,
+            refillNumber = 20,
+            cacheLimit = 2 * refillNumber,
+            largeBytes = 2097152
+        };
+    private:
+        struct cache {
+            node *freeList[freeListNumber];
+            sizeType count[freeListNumber];
+            ~cache() noexcept;
+        };
+    private:
+        static node *freeList[freeListNumber];
+        static char *chunk;
+        static char *chunkCursor;
+        static char *chunkEnd;
+        static sizeType heapSize;
+        static std::mutex depotMutex;
+        static thread_local cache localCache;
+    private:
+        static constexpr sizeType roundUp(sizeType) noexcept;
+        static constexpr sizeType freeListIndex(sizeType) noexcept;
+        static char *chunkAllocate(sizeType, sizeType &);
+        static void fetch(cache &, sizeType, sizeType);
+        static void flush(cache &, sizeType, sizeType) noexcept;
+#ifdef __DATA_STRUCTURE_LARGE_ALLOCATION
+        static sizeType mapBytes(sizeType) noexcept;
+        static void advise(void *, sizeType) noexcept;
+        static void *mapAllocate(sizeType);
+        static void mapDeallocate(void *, sizeType) noexcept;
+        static void *mapReallocate(void *, sizeType, sizeType);
+#endif
+    public:
+        __DataStructure_MemoryPool() = delete;
+        __DataStructure_MemoryPool(const __DataStructure_MemoryPool &) = delete;
+        __DataStructure_MemoryPool(__DataStructure_MemoryPool &&) noexcept = delete;
+        ~__DataStructure_MemoryPool() = delete;
+    public:
+        static constexpr bool mapped(sizeType) noexcept;
+        static void *allocate(sizeType);
+        static void deallocate(void *, sizeType) noexcept;
+        static void *reallocate(void *, sizeType, sizeType);
+        static void release() noexcept;
+    };
     template <typename T>
     class Allocator {
     private:
@@ -26,8 +97,7 @@ namespace DataStructure {
         pointer first;
         pointer cursor;
     private:
-        static char *chunk;
-        static char *chunk_cursor;
+        using memoryPool = __DataStructure_MemoryPool<>;
     private:
         static void destroy(void *, __DataStructure_falseType);
         static void destroy(void *, __DataStructure_trueType) noexcept;
@@ -35,7 +105,8 @@ namespace DataStructure {
         static void destroy(const void *, const void *, __DataStructure_trueType) noexcept;
     public:
         static void *operator new (sizeType);
-        static void operator delete (void *) noexcept;
+        static void operator delete (void *, sizeType) noexcept;
+        static void release() noexcept;
         static void destroy(void *) noexcept(
                     static_cast<bool>(
                             typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
@@ -48,12 +119,14 @@ namespace DataStructure {
                 );
     private:
         void copyRHS(const Allocator &);
-        void free(pointer) noexcept(
+        void free(pointer, sizeType) noexcept(
                     static_cast<bool>(
                             typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
                     )
                 );
-        void reallocate();
+        void reallocate(sizeType, __DataStructure_trueType);
+        void reallocate(sizeType, __DataStructure_falseType);
+        void reallocate(sizeType);
         void check(pointer) const;
     public:
         constexpr Allocator();
@@ -120,6 +193,319 @@ namespace DataStructure {
     };
     template <typename T>
     void swap(Allocator<T> &, Allocator<T> &) noexcept;
+    template <typename NodeType, typename Alloc, typename Owner = void>
+    class __DataStructure_NodeSlab final {
+    public:
+        using sizeType = typename Alloc::sizeType;
+        using differenceType = typename Alloc::differenceType;
+    private:
+        struct chunk {
+            chunk *next;
+            sizeType size;
+        };
+        struct link {
+            link *next;
+        };
+        struct depot {
+            std::atomic<sizeType> reference;
+            std::atomic<chunk *> chunks;
+            std::atomic<depot *> parent;
+        };
+    private:
+        enum : sizeType {
+            headerSize = (sizeof(chunk) + alignof(NodeType) - 1) / alignof(NodeType) * alignof(NodeType),
+            minimumNodes = 4,
+            maximumBytes = 65536,
+            maximumNodes = sizeof(NodeType) * minimumNodes < maximumBytes ?
+                                    maximumBytes / sizeof(NodeType) : minimumNodes
+        };
+    private:
+        chunk *chunks;
+        depot *group;
+        link *freeList;
+        char *cursor;
+        char *end;
+        sizeType nodes;
+    private:
+        static void freeChunks(chunk *) noexcept;
+        static void pushChunks(depot *, chunk *) noexcept;
+        static depot *root(depot *) noexcept;
+        static void leave(depot *) noexcept;
+        void addChunk();
+    public:
+        __DataStructure_NodeSlab() noexcept;
+        __DataStructure_NodeSlab(const __DataStructure_NodeSlab &) = delete;
+        __DataStructure_NodeSlab(__DataStructure_NodeSlab &&) noexcept;
+        ~__DataStructure_NodeSlab() noexcept;
+    public:
+        __DataStructure_NodeSlab &operator=(const __DataStructure_NodeSlab &) = delete;
+        __DataStructure_NodeSlab &operator=(__DataStructure_NodeSlab &&) = delete;
+    public:
+        NodeType *allocate();
+        void deallocate(NodeType *) noexcept;
+        void release() noexcept;
+        void share(__DataStructure_NodeSlab &);
+        void swap(__DataStructure_NodeSlab &) noexcept;
+    };
+}
+
+template <typename Tag>
+typename DataStructure::__DataStructure_MemoryPool<Tag>::node *
+DataStructure::__DataStructure_MemoryPool<Tag>::freeList[freeListNumber] {};
+template <typename Tag>
+char *DataStructure::__DataStructure_MemoryPool<Tag>::chunk {nullptr};
+template <typename Tag>
+char *DataStructure::__DataStructure_MemoryPool<Tag>::chunkCursor {nullptr};
+template <typename Tag>
+char *DataStructure::__DataStructure_MemoryPool<Tag>::chunkEnd {nullptr};
+template <typename Tag>
+typename DataStructure::__DataStructure_MemoryPool<Tag>::sizeType
+DataStructure::__DataStructure_MemoryPool<Tag>::heapSize {0};
+template <typename Tag>
+std::mutex DataStructure::__DataStructure_MemoryPool<Tag>::depotMutex {};
+template <typename Tag>
+thread_local typename DataStructure::__DataStructure_MemoryPool<Tag>::cache
+DataStructure::__DataStructure_MemoryPool<Tag>::localCache {};
+
+template <typename Tag>
+DataStructure::__DataStructure_MemoryPool<Tag>::cache::~cache() noexcept {
+    for(auto i {static_cast<sizeType>(0)}; i < static_cast<sizeType>(freeListNumber); ++i) {
+        if(this->count[i]) {
+            __DataStructure_MemoryPool::flush(*this, i, this->count[i]);
+        }
+    }
+}
+
+template <typename Tag>
+inline constexpr typename DataStructure::__DataStructure_MemoryPool<Tag>::sizeType
+DataStructure::__DataStructure_MemoryPool<Tag>::roundUp(sizeType size) noexcept {
+    return (size + static_cast<sizeType>(align) - 1) & ~(static_cast<sizeType>(align) - 1);
+}
+template <typename Tag>
+inline constexpr typename DataStructure::__DataStructure_MemoryPool<Tag>::sizeType
+DataStructure::__DataStructure_MemoryPool<Tag>::freeListIndex(sizeType size) noexcept {
+    return (size + static_cast<sizeType>(align) - 1) / static_cast<sizeType>(align) - 1;
+}
+template <typename Tag>
+char *DataStructure::__DataStructure_MemoryPool<Tag>::chunkAllocate(sizeType size, sizeType &number) {
+    auto totalSize {size * number};
+    auto leftSize {static_cast<sizeType>(chunkEnd - chunkCursor)};
+    if(leftSize >= totalSize) {
+        auto result {chunkCursor};
+        chunkCursor += totalSize;
+        return result;
+    }
+    if(leftSize >= size) {
+        number = leftSize / size;
+        auto result {chunkCursor};
+        chunkCursor += size * number;
+        return result;
+    }
+    if(leftSize) {
+        auto leftover {reinterpret_cast<node *>(chunkCursor)};
+        auto &list {freeList[freeListIndex(leftSize)]};
+        leftover->next = list;
+        list = leftover;
+    }
+    const auto bytes {
+        static_cast<sizeType>(align) + 2 * totalSize + roundUp(heapSize >> 4)
+    };
+    auto newChunk {reinterpret_cast<char *>(::operator new (bytes))};
+    *reinterpret_cast<char **>(newChunk) = chunk;
+    chunk = newChunk;
+    chunkCursor = newChunk + static_cast<differenceType>(align);
+    chunkEnd = newChunk + bytes;
+    heapSize += bytes;
+    return chunkAllocate(size, number);
+}
+template <typename Tag>
+void DataStructure::__DataStructure_MemoryPool<Tag>::fetch(cache &local, sizeType index, sizeType size) {
+    std::lock_guard<std::mutex> lock {depotMutex};
+    auto &list {freeList[index]};
+    if(list) {
+        auto cursor {list};
+        sizeType number {1};
+        for(; number < static_cast<sizeType>(refillNumber) and cursor->next; ++number) {
+            cursor = cursor->next;
+        }
+        local.freeList[index] = list;
+        local.count[index] = number;
+        list = cursor->next;
+        cursor->next = nullptr;
+        return;
+    }
+    sizeType number {refillNumber};
+    auto block {chunkAllocate(size, number)};
+    auto cursor {reinterpret_cast<node *>(block)};
+    local.freeList[index] = cursor;
+    local.count[index] = number;
+    for(auto i {static_cast<sizeType>(1)}; i < number; ++i) {
+        auto next {reinterpret_cast<node *>(reinterpret_cast<char *>(cursor) + size)};
+        cursor->next = next;
+        cursor = next;
+    }
+    cursor->next = nullptr;
+}
+template <typename Tag>
+void DataStructure::__DataStructure_MemoryPool<Tag>::flush(cache &local, sizeType index, sizeType number) noexcept {
+    auto first {local.freeList[index]};
+    auto last {first};
+    for(auto i {static_cast<sizeType>(1)}; i < number; ++i) {
+        last = last->next;
+    }
+    local.freeList[index] = last->next;
+    local.count[index] -= number;
+    std::lock_guard<std::mutex> lock {depotMutex};
+    last->next = freeList[index];
+    freeList[index] = first;
+}
+#ifdef __DATA_STRUCTURE_LARGE_ALLOCATION
+template <typename Tag>
+inline typename DataStructure::__DataStructure_MemoryPool<Tag>::sizeType
+DataStructure::__DataStructure_MemoryPool<Tag>::mapBytes(sizeType size) noexcept {
+    static const auto page {static_cast<sizeType>(sysconf(_SC_PAGESIZE))};
+    return (size + page - 1) / page * page;
+}
+template <typename Tag>
+inline void DataStructure::__DataStructure_MemoryPool<Tag>::advise(void *p, sizeType bytes) noexcept {
+#if defined(HUGE_PAGE_DATA_STRUCTURE) and defined(MADV_HUGEPAGE)
+    madvise(p, bytes, MADV_HUGEPAGE);
+#else
+    static_cast<void>(p);
+    static_cast<void>(bytes);
+#endif
+}
+template <typename Tag>
+void *DataStructure::__DataStructure_MemoryPool<Tag>::mapAllocate(sizeType size) {
+    const auto bytes {mapBytes(size)};
+    auto result {mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+    if(result == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    advise(result, bytes);
+    return result;
+}
+template <typename Tag>
+void DataStructure::__DataStructure_MemoryPool<Tag>::mapDeallocate(void *p, sizeType size) noexcept {
+    munmap(p, mapBytes(size));
+}
+template <typename Tag>
+void *DataStructure::__DataStructure_MemoryPool<Tag>::mapReallocate(void *p, sizeType oldSize, sizeType newSize) {
+    const auto oldBytes {mapBytes(oldSize)};
+    const auto newBytes {mapBytes(newSize)};
+    if(oldBytes == newBytes) {
+        return p;
+    }
+    auto result {mremap(p, oldBytes, newBytes, MREMAP_MAYMOVE)};
+    if(result == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    advise(result, newBytes);
+    return result;
+}
+#endif
+template <typename Tag>
+inline constexpr bool DataStructure::__DataStructure_MemoryPool<Tag>::mapped(sizeType size) noexcept {
+#ifdef __DATA_STRUCTURE_LARGE_ALLOCATION
+    return size >= static_cast<sizeType>(largeBytes);
+#else
+    return static_cast<void>(size), false;
+#endif
+}
+template <typename Tag>
+void *DataStructure::__DataStructure_MemoryPool<Tag>::allocate(sizeType size) {
+#ifdef __DATA_STRUCTURE_LARGE_ALLOCATION
+    if(size >= static_cast<sizeType>(largeBytes)) {
+        return mapAllocate(size);
+    }
+#endif
+    if(size > static_cast<sizeType>(maxBytes)) {
+        auto result {std::malloc(size)};
+        if(not result) {
+            throw std::bad_alloc();
+        }
+        return result;
+    }
+    if(not size) {
+        size = static_cast<sizeType>(align);
+    }
+    const auto index {freeListIndex(size)};
+    auto &local {localCache};
+    if(not local.freeList[index]) {
+        fetch(local, index, roundUp(size));
+    }
+    auto result {local.freeList[index]};
+    local.freeList[index] = result->next;
+    --local.count[index];
+    return result;
+}
+template <typename Tag>
+void DataStructure::__DataStructure_MemoryPool<Tag>::deallocate(void *p, sizeType size) noexcept {
+    if(not p) {
+        return;
+    }
+#ifdef __DATA_STRUCTURE_LARGE_ALLOCATION
+    if(size >= static_cast<sizeType>(largeBytes)) {
+        mapDeallocate(p, size);
+        return;
+    }
+#endif
+    if(size > static_cast<sizeType>(maxBytes)) {
+        std::free(p);
+        return;
+    }
+    if(not size) {
+        size = static_cast<sizeType>(align);
+    }
+    const auto index {freeListIndex(size)};
+    auto &local {localCache};
+    auto returned {reinterpret_cast<node *>(p)};
+    returned->next = local.freeList[index];
+    local.freeList[index] = returned;
+    if(++local.count[index] > static_cast<sizeType>(cacheLimit)) {
+        flush(local, index, refillNumber);
+    }
+}
+template <typename Tag>
+void *DataStructure::__DataStructure_MemoryPool<Tag>::reallocate(void *p, sizeType oldSize, sizeType newSize) {
+#ifdef __DATA_STRUCTURE_LARGE_ALLOCATION
+    if(p and oldSize >= static_cast<sizeType>(largeBytes) and newSize >= static_cast<sizeType>(largeBytes)) {
+        return mapReallocate(p, oldSize, newSize);
+    }
+#endif
+    if(oldSize > static_cast<sizeType>(maxBytes) and newSize > static_cast<sizeType>(maxBytes) and
+            not mapped(oldSize) and not mapped(newSize)) {
+        auto result {std::realloc(p, newSize)};
+        if(not result) {
+            throw std::bad_alloc();
+        }
+        return result;
+    }
+    auto result {allocate(newSize)};
+    if(p) {
+        std::memcpy(result, p, oldSize < newSize ? oldSize : newSize);
+        deallocate(p, oldSize);
+    }
+    return result;
+}
+template <typename Tag>
+void DataStructure::__DataStructure_MemoryPool<Tag>::release() noexcept {
+    auto &local {localCache};
+    for(auto i {static_cast<sizeType>(0)}; i < static_cast<sizeType>(freeListNumber); ++i) {
+        local.freeList[i] = nullptr;
+        local.count[i] = 0;
+    }
+    std::lock_guard<std::mutex> lock {depotMutex};
+    while(chunk) {
+        auto next {*reinterpret_cast<char **>(chunk)};
+        ::operator delete (chunk);
+        chunk = next;
+    }
+    for(auto &list : freeList) {
+        list = nullptr;
+    }
+    chunkCursor = chunkEnd = nullptr;
+    heapSize = 0;
 }
 
 template <typename T>
@@ -135,7 +521,7 @@ inline void DataStructure::swap(Allocator<T> &lhs, Allocator<T> &rhs) noexcept {
 }
 template <typename T>
 inline void DataStructure::Allocator<T>::destroy(void *p, __DataStructure_falseType) {
-    reinterpret_cast<pointer>(p)->valueType();
+    reinterpret_cast<pointer>(p)->~valueType();
 }
 template <typename T>
 inline void DataStructure::Allocator<T>::destroy(void *, __DataStructure_trueType) noexcept {}
@@ -144,10 +530,10 @@ inline void
 DataStructure::Allocator<T>::destroy(const void *, const void *, __DataStructure_trueType) noexcept {}
 template <typename T>
 inline void DataStructure::Allocator<T>::destroy(void *first, void *last, __DataStructure_falseType) {
-    --reinterpret_cast<pointer>(last);
-    reinterpret_cast<pointer>(first)->~valueType();
-    while(first not_eq last) {
-        reinterpret_cast<pointer>(last)--->~valueType();
+    auto begin {reinterpret_cast<pointer>(first)};
+    auto cursor {reinterpret_cast<pointer>(last)};
+    while(cursor not_eq begin) {
+        (--cursor)->~valueType();
     }
 }
 template <typename T>
@@ -157,7 +543,7 @@ inline void DataStructure::Allocator<T>::copyRHS(const Allocator<T> &rhs) {
     }
 }
 template <typename T>
-inline void DataStructure::Allocator<T>::free(pointer p) noexcept(
+inline void DataStructure::Allocator<T>::free(pointer p, sizeType size) noexcept(
             static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
         ) {
     if(not p) {
@@ -166,21 +552,52 @@ inline void DataStructure::Allocator<T>::free(pointer p) noexcept(
     Allocator::destroy(
             p, this->cursor, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
     );
-    Allocator::operator delete (p);
+    Allocator::operator delete (p, sizeof(valueType) * size);
 }
 template <typename T>
-inline void DataStructure::Allocator<T>::reallocate() {
-    auto newFirst {reinterpret_cast<pointer>(
-                        Allocator::operator new (sizeof(valueType) * this->allocateSize)
-                  )};
-    auto cursor {this->first};
-    for(auto i {0}; cursor not_eq this->cursor;) {
-        new (newFirst + i++) valueType(move(*cursor++));
-    }
+inline void DataStructure::Allocator<T>::reallocate(sizeType newSize, __DataStructure_trueType) {
     const auto size {this->cursor - this->first};
-    this->free(this->first);
-    this->first = newFirst;
+    const auto oldBytes {sizeof(valueType) * this->allocateSize};
+    const auto newBytes {sizeof(valueType) * newSize};
+    if(alignof(valueType) > static_cast<sizeType>(memoryPool::align) and
+            not (memoryPool::mapped(oldBytes) and memoryPool::mapped(newBytes))) {
+        auto newFirst {reinterpret_cast<pointer>(Allocator::operator new (newBytes))};
+        if(this->first) {
+            std::memcpy(newFirst, this->first, sizeof(valueType) * size);
+            Allocator::operator delete (this->first, oldBytes);
+        }
+        this->first = newFirst;
+    }else {
+        this->first = reinterpret_cast<pointer>(memoryPool::reallocate(this->first, oldBytes, newBytes));
+    }
     this->cursor = this->first + size;
+    this->allocateSize = newSize;
+}
+template <typename T>
+inline void DataStructure::Allocator<T>::reallocate(sizeType newSize) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(Allocator, REALLOCATE);
+    this->reallocate(newSize, typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable());
+}
+template <typename T>
+inline void DataStructure::Allocator<T>::reallocate(sizeType newSize, __DataStructure_falseType) {
+    auto newFirst {reinterpret_cast<pointer>(Allocator::operator new (sizeof(valueType) * newSize))};
+    auto newCursor {newFirst};
+    try {
+        for(auto cursor {this->first}; cursor not_eq this->cursor;) {
+            new (newCursor) valueType(move(*cursor++));
+            ++newCursor;
+        }
+    }catch(...) {
+        Allocator::destroy(
+                newFirst, newCursor, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+        );
+        Allocator::operator delete (newFirst, sizeof(valueType) * newSize);
+        throw;
+    }
+    this->free(this->first, this->allocateSize);
+    this->first = newFirst;
+    this->cursor = newCursor;
+    this->allocateSize = newSize;
 }
 template <typename T>
 inline void DataStructure::Allocator<T>::check(pointer p) const {
@@ -190,11 +607,23 @@ inline void DataStructure::Allocator<T>::check(pointer p) const {
 }
 template <typename T>
 void *DataStructure::Allocator<T>::operator new (sizeType size) {
-    return ::operator new (size);
+    __DATA_STRUCTURE_STATISTICS_COUNT(Allocator, ALLOCATE);
+    if(alignof(valueType) > static_cast<sizeType>(memoryPool::align) and not memoryPool::mapped(size)) {
+        return ::operator new (size);
+    }
+    return memoryPool::allocate(size);
 }
 template <typename T>
-void DataStructure::Allocator<T>::operator delete (void *p) noexcept {
-    ::operator delete (p);
+void DataStructure::Allocator<T>::operator delete (void *p, sizeType size) noexcept {
+    if(alignof(valueType) > static_cast<sizeType>(memoryPool::align) and not memoryPool::mapped(size)) {
+        ::operator delete (p);
+        return;
+    }
+    memoryPool::deallocate(p, size);
+}
+template <typename T>
+void DataStructure::Allocator<T>::release() noexcept {
+    memoryPool::release();
 }
 template <typename T>
 void DataStructure::Allocator<T>::destroy(void *p) noexcept(
@@ -202,6 +631,7 @@ void DataStructure::Allocator<T>::destroy(void *p) noexcept(
                     typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
             )
         ) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(Allocator, DESTROY);
     Allocator::destroy(p,
                     typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
                );
@@ -212,7 +642,8 @@ void DataStructure::Allocator<T>::destroy(void *first, const void *last) noexcep
                     typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
             )
         ) {
-    Allocator::destroy(first, last,
+    __DATA_STRUCTURE_STATISTICS_COUNT(Allocator, DESTROY);
+    Allocator::destroy(first, const_cast<void *>(last),
                     typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
                );
 }
@@ -234,7 +665,7 @@ DataStructure::Allocator<T>::Allocator(Allocator<T> &&rhs) noexcept : allocateSi
 }
 template <typename T>
 DataStructure::Allocator<T>::~Allocator() {
-    this->free(this->first);
+    this->free(this->first, this->allocateSize);
 }
 template <typename T>
 DataStructure::Allocator<T> &DataStructure::Allocator<T>::operator=(const Allocator &rhs) & {
@@ -247,7 +678,7 @@ DataStructure::Allocator<T> &DataStructure::Allocator<T>::operator=(const Alloca
         this->first = temp;
         throw;
     }
-    this->free(temp);
+    this->free(temp, this->allocateSize);
     this->cursor = this->first;
     this->allocateSize = rhs.allocateSize;
     this->copyRHS(rhs);
@@ -258,7 +689,7 @@ DataStructure::Allocator<T> &DataStructure::Allocator<T>::operator=(Allocator &&
     if(&rhs == this) {
         return *this;
     }
-    this->free(this->first);
+    this->free(this->first, this->allocateSize);
     this->first = rhs.first;
     this->allocateSize = rhs.allocateSize;
     this->cursor = rhs.cursor;
@@ -313,6 +744,7 @@ DataStructure::Allocator<T>::construct(pointer p, constReference value) & noexce
                     typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
             )
 ) {
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Allocator, constReference);
     this->check(p);
     new (p) valueType(value);
     if(p == this->cursor) {
@@ -327,6 +759,7 @@ DataStructure::Allocator<T>::construct(pointer p, rightValueReference value) & n
                     typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
             )
 ) {
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Allocator, rightValueReference);
     this->check(p);
     new (p) valueType(move(value));
     if(p == this->cursor) {
@@ -345,6 +778,7 @@ typename DataStructure::Allocator<T>::pointer
 DataStructure::Allocator<T>::destroy(pointer p) & noexcept(
             static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
         ) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(Allocator, DESTROY);
     Allocator::destroy(p, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor());
     if(this->cursor - 1 == p) {
         --this->cursor;
@@ -356,8 +790,10 @@ typename DataStructure::Allocator<T>::pointer
 DataStructure::Allocator<T>::destroy(pointer first, constPointer last) & noexcept(
             static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
         ) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(Allocator, DESTROY);
     Allocator::destroy(
-            first, last, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+            first, const_cast<pointer>(last),
+            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
     );
     if(this->cursor == last) {
         this->cursor = first;
@@ -411,8 +847,7 @@ typename DataStructure::Allocator<T>::pointer DataStructure::Allocator<T>::resiz
     if(size <= this->allocateSize) {
         return this->first;
     }
-    this->allocateSize = size;
-    this->reallocate();
+    this->reallocate(size);
     return this->first;
 }
 template <typename T>
@@ -421,8 +856,7 @@ typename DataStructure::Allocator<T>::pointer DataStructure::Allocator<T>::shrin
     if(size == this->allocateSize) {
         return this->first;
     }
-    this->allocateSize = size;
-    this->reallocate();
+    this->reallocate(size);
     return this->first;
 }
 template <typename T>
@@ -446,6 +880,161 @@ typename DataStructure::Allocator<T>::pointer DataStructure::Allocator<T>::clear
     this->cursor = this->first;
     return this->cursor;
 }
+template <typename NodeType, typename Alloc, typename Owner>
+void DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::freeChunks(chunk *list) noexcept {
+    while(list) {
+        auto next {list->next};
+        Alloc::operator delete (list, list->size);
+        list = next;
+    }
+}
+template <typename NodeType, typename Alloc, typename Owner>
+void DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::pushChunks(depot *d, chunk *list) noexcept {
+    if(not list) {
+        return;
+    }
+    auto last {list};
+    while(last->next) {
+        last = last->next;
+    }
+    last->next = d->chunks.load(std::memory_order_relaxed);
+    while(not d->chunks.compare_exchange_weak(last->next, list, std::memory_order_release,
+            std::memory_order_relaxed)) {}
+}
+template <typename NodeType, typename Alloc, typename Owner>
+typename DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::depot *
+DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::root(depot *d) noexcept {
+    for(auto parent {d->parent.load(std::memory_order_acquire)}; parent;
+            parent = d->parent.load(std::memory_order_acquire)) {
+        d = parent;
+    }
+    return d;
+}
+template <typename NodeType, typename Alloc, typename Owner>
+void DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::leave(depot *d) noexcept {
+    while(d and d->reference.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        auto parent {d->parent.load(std::memory_order_acquire)};
+        auto list {d->chunks.exchange(nullptr, std::memory_order_acquire)};
+        if(parent) {
+            __DataStructure_NodeSlab::pushChunks(parent, list);
+        }else {
+            __DataStructure_NodeSlab::freeChunks(list);
+        }
+        d->~depot();
+        Alloc::operator delete (d, sizeof(depot));
+        d = parent;
+    }
+}
+template <typename NodeType, typename Alloc, typename Owner>
+void DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::addChunk() {
+    auto number {this->nodes};
+    if(number < static_cast<sizeType>(minimumNodes)) {
+        number = static_cast<sizeType>(minimumNodes);
+    }else if(number > static_cast<sizeType>(maximumNodes)) {
+        number = static_cast<sizeType>(maximumNodes);
+    }
+    const auto bytes {static_cast<sizeType>(headerSize) + sizeof(NodeType) * number};
+    auto newChunk {reinterpret_cast<chunk *>(Alloc::operator new (bytes))};
+    __DATA_STRUCTURE_STATISTICS_COUNT(Owner, ALLOCATE);
+    newChunk->next = this->chunks;
+    newChunk->size = bytes;
+    this->chunks = newChunk;
+    this->cursor = reinterpret_cast<char *>(newChunk) + static_cast<differenceType>(headerSize);
+    this->end = reinterpret_cast<char *>(newChunk) + static_cast<differenceType>(bytes);
+    this->nodes += number;
+}
+template <typename NodeType, typename Alloc, typename Owner>
+inline DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::__DataStructure_NodeSlab() noexcept :
+        chunks {nullptr}, group {nullptr}, freeList {nullptr}, cursor {nullptr}, end {nullptr}, nodes {0} {}
+template <typename NodeType, typename Alloc, typename Owner>
+inline DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::__DataStructure_NodeSlab(
+        __DataStructure_NodeSlab &&rhs
+) noexcept : __DataStructure_NodeSlab() {
+    this->swap(rhs);
+}
+template <typename NodeType, typename Alloc, typename Owner>
+inline DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::~__DataStructure_NodeSlab() noexcept {
+    this->release();
+}
+template <typename NodeType, typename Alloc, typename Owner>
+inline NodeType *DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::allocate() {
+    if(this->freeList) {
+        auto result {this->freeList};
+        this->freeList = result->next;
+        return reinterpret_cast<NodeType *>(result);
+    }
+    if(this->cursor == this->end) {
+        this->addChunk();
+    }
+    auto result {this->cursor};
+    this->cursor += static_cast<differenceType>(sizeof(NodeType));
+    return reinterpret_cast<NodeType *>(result);
+}
+template <typename NodeType, typename Alloc, typename Owner>
+inline void DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::deallocate(NodeType *p) noexcept {
+    auto returned {reinterpret_cast<link *>(p)};
+    returned->next = this->freeList;
+    this->freeList = returned;
+}
+template <typename NodeType, typename Alloc, typename Owner>
+void DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::release() noexcept {
+    if(this->group) {
+        __DataStructure_NodeSlab::pushChunks(this->group, this->chunks);
+        __DataStructure_NodeSlab::leave(this->group);
+        this->group = nullptr;
+    }else {
+        __DataStructure_NodeSlab::freeChunks(this->chunks);
+    }
+    this->chunks = nullptr;
+    this->freeList = nullptr;
+    this->cursor = this->end = nullptr;
+    this->nodes = 0;
+}
+template <typename NodeType, typename Alloc, typename Owner>
+void DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::share(__DataStructure_NodeSlab &rhs) {
+    if(this == &rhs or (not rhs.chunks and not rhs.group)) {
+        return;
+    }
+    if(not this->group or not rhs.group) {
+        auto &joined {this->group ? rhs : *this};
+        auto &other {this->group ? *this : rhs};
+        if(other.group) {
+            joined.group = __DataStructure_NodeSlab::root(other.group);
+            joined.group->reference.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        this->group = rhs.group = new (Alloc::operator new (sizeof(depot))) depot {{2}, {nullptr}, {nullptr}};
+        return;
+    }
+    while(true) {
+        auto lhsRoot {__DataStructure_NodeSlab::root(this->group)};
+        auto rhsRoot {__DataStructure_NodeSlab::root(rhs.group)};
+        if(lhsRoot == rhsRoot) {
+            return;
+        }
+        auto parent {lhsRoot}, child {rhsRoot};
+        if(reinterpret_cast<std::uintptr_t>(parent) > reinterpret_cast<std::uintptr_t>(child)) {
+            parent = rhsRoot;
+            child = lhsRoot;
+        }
+        parent->reference.fetch_add(1, std::memory_order_relaxed);
+        depot *expected {nullptr};
+        if(child->parent.compare_exchange_strong(expected, parent, std::memory_order_acq_rel)) {
+            return;
+        }
+        parent->reference.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+template <typename NodeType, typename Alloc, typename Owner>
+void DataStructure::__DataStructure_NodeSlab<NodeType, Alloc, Owner>::swap(__DataStructure_NodeSlab &rhs) noexcept {
+    using std::swap;
+    swap(this->chunks, rhs.chunks);
+    swap(this->group, rhs.group);
+    swap(this->freeList, rhs.freeList);
+    swap(this->cursor, rhs.cursor);
+    swap(this->end, rhs.end);
+    swap(this->nodes, rhs.nodes);
+}
 #ifdef DEBUG_DATA_STRUCTURE_FOR_ALLOCATOR
 template <typename T>
 typename DataStructure::Allocator<T>::sizeType &DataStructure::Allocator<T>::getAllocateSize() & noexcept {
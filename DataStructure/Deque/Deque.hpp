@@ -5,6 +5,9 @@
 #include "../Iterator.hpp"
 
 namespace DataStructure {
+    constexpr unsigned long __DataStructure_dequeBufferSize(unsigned long size) noexcept {
+        return size <= 1 ? 1 : __DataStructure_dequeBufferSize((size + 1) >> 1) << 1;
+    }
     template <typename T, typename Alloc = Allocator<T>, unsigned long BufferSize = 64>
     class Deque final {
     public:
@@ -17,58 +20,71 @@ namespace DataStructure {
         using rightValueReference = typename allocator::rightValueReference;
         using pointer = typename allocator::pointer;
         using constPointer = typename allocator::constPointer;
-        using iterator = __DataStructure_DequeIterator<valueType, reference, pointer, allocator>;
-        using constIterator = __DataStructure_DequeIterator<valueType, constReference, constPointer, allocator>;
+    private:
+        enum : unsigned long {
+            bufferSize = __DataStructure_dequeBufferSize((BufferSize == 0) ? static_cast<unsigned long>(
+                            sizeof(valueType) > 512 ? 1 : 256 / sizeof(valueType)
+                         ) : BufferSize)
+        };
+    public:
+        using iterator = __DataStructure_DequeIterator<valueType, reference, pointer, bufferSize>;
+        using constIterator = __DataStructure_DequeIterator<valueType, constReference, constPointer, bufferSize>;
         using reverseIterator = __DataStructure_ReverseIterator<iterator, constIterator>;
         using constReverseIterator = __DataStructure_ReverseIterator<constIterator, iterator>;
     private:
-        using bufferType = allocator *;
+        using map = typename iterator::map;
     private:
         enum : unsigned long {
-            bufferSize = (BufferSize == 0) ? static_cast<unsigned long>(
-                                                sizeof(valueType) > 512 ? 1 : 256 / sizeof(valueType)
-                                             ) : BufferSize
-        };
-        enum : unsigned long {
-            preserveSize = static_cast<unsigned long>(2)
-        };
-        enum class __Deque_CheckParameter {
-            TAIL_SUCCESSFUL, HEAD_SUCCESSFUL, ALL_FAILED
+            preserveSize = static_cast<unsigned long>(2),
+            mapSize = static_cast<unsigned long>(8),
+            cacheSize = static_cast<unsigned long>(4)
         };
     private:
         sizeType bufferNumber;
-        bufferType buffer;
+        map buffer;
         iterator last;
         iterator first;
+        pointer cache;
+        sizeType cacheNumber;
+        sizeType highWaterMark;
     private:
-        constexpr static sizeType startSize(sizeType = 0) noexcept;
+        constexpr static sizeType bufferBytes() noexcept;
+        static pointer allocateBuffer();
+        static void deallocateBuffer(pointer) noexcept;
+        static map allocateMap(sizeType);
+        template <typename InputIterator>
+        using isMemoryCopyable = typename __DataStructure_BooleanType<
+                static_cast<bool>(typename IsPointer<InputIterator>::result()) and
+                static_cast<bool>(typename IsSame<
+                        typename RemoveConst<typename RemovePointer<InputIterator>::type>::type, valueType
+                >::result()) and
+                static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialCopyConstructor())
+        >::__result;
+        template <typename InputIterator>
+        static void copySegment(pointer, InputIterator &, sizeType, __DataStructure_trueType) noexcept;
+        template <typename InputIterator>
+        static void copySegment(pointer, InputIterator &, sizeType, __DataStructure_falseType);
+        static void fillSegment(pointer, sizeType, constReference);
+        template <typename Function>
+        static void constructAuxiliary(iterator &, sizeType, Function);
     private:
-        void initBuffer(sizeType = 0);
+        pointer acquireBuffer();
+        void recycleBuffer(pointer) noexcept;
+        void freeCache() noexcept;
+        void initBuffer(sizeType);
         void free() noexcept(
                 static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
         );
-        __Deque_CheckParameter checkReserve(sizeType, bool = false) const noexcept;
-        template <typename Type>
-        void insertBackwardAuxiliary(Type, sizeType, iterator);
-        template <typename Type>
-        void insertForwardAuxiliary(Type, sizeType, iterator);
+        void releaseBuffer() noexcept;
+        void reallocateMap(sizeType, bool);
         void addBuffer(sizeType, bool = false);
+        iterator makeGap(differenceType, sizeType);
         template <typename Type>
-        iterator insertAuxiliary(differenceType, Type, sizeType, bool);
-        template <typename InputIterator,
-                        typename __DataStructure_isInputIterator<InputIterator>::__result * = nullptr>
-        void insertBackwardAuxiliaryForIterator(typename __DataStructure_isInputIterator<InputIterator>::__result,
-                InputIterator, iterator, sizeType
-        );
-        template <typename InputIterator,
-                        typename __DataStructure_isInputIterator<InputIterator>::__result * = nullptr>
-        void insertForwardAuxiliaryForIterator(typename __DataStructure_isInputIterator<InputIterator>::__result,
-                InputIterator, iterator, sizeType
-        );
+        iterator insertAuxiliary(differenceType, Type, sizeType);
         template <typename InputIterator,
                 typename __DataStructure_isInputIterator<InputIterator>::__result * = nullptr>
         iterator insertAuxiliaryForIterator(differenceType,
-                typename __DataStructure_isInputIterator<InputIterator>::__result, InputIterator, bool
+                typename __DataStructure_isInputIterator<InputIterator>::__result, InputIterator
         );
         void eraseForwardAuxiliary(differenceType, sizeType);
         void eraseBackwardAuxiliary(differenceType, sizeType);
@@ -76,7 +92,8 @@ namespace DataStructure {
         void pushFrontAuxiliary(Type);
         template <typename Type>
         void pushBackAuxiliary(Type);
-        void shrink(bool = false);
+        template <typename Function>
+        bool forEachSegmentPair(const Deque &, Function) const;
     public:
         Deque();
         explicit Deque(sizeType);
@@ -158,6 +175,15 @@ namespace DataStructure {
         void pushBack(rightValueReference);
         void pushFront(constReference);
         void pushFront(rightValueReference);
+        void pushBackN(sizeType, constReference);
+        template <typename InputIterator,
+                typename __DataStructure_isInputIterator<InputIterator>::__result * = nullptr
+        >
+        void appendRange(typename __DataStructure_isInputIterator<InputIterator>::__result, InputIterator);
+        template <typename InputIterator,
+                typename __DataStructure_isInputIterator<InputIterator>::__result * = nullptr
+        >
+        void prependRange(typename __DataStructure_isInputIterator<InputIterator>::__result, InputIterator);
 #ifdef POP_GET_OBJECT
         valueType
 #else
@@ -179,10 +205,13 @@ namespace DataStructure {
         template <typename ...Args>
         void emplaceFront(Args &&...);
         void swap(Deque &) noexcept;
-        bufferType getAllocator() const & noexcept;
+        template <typename Function>
+        void forEachSegment(Function) const;
+        sizeType getHighWaterMark() const noexcept;
+        void setHighWaterMark(sizeType) noexcept;
 #ifdef DEBUG_DATA_STRUCTURE_FOR_DEQUE
         sizeType &getBufferNumber() & noexcept;
-        bufferType &getBuffer() & noexcept;
+        map &getBuffer() & noexcept;
         iterator &getFirst() & noexcept;
         iterator &getLast() & noexcept;
 #endif
@@ -198,200 +227,298 @@ void DataStructure::swap(Deque<T, Allocator, BufferSize> &lhs, Deque<T, Allocato
 
 template <typename T, typename Allocator, unsigned long BufferSize>
 inline constexpr typename DataStructure::Deque<T, Allocator, BufferSize>::sizeType
-DataStructure::Deque<T, Allocator, BufferSize>::startSize(sizeType size) noexcept {
-    return (size + static_cast<sizeType>(Deque::preserveSize)) /
-                static_cast<sizeType>(Deque::bufferSize) == 0ul ? 1ul :
-                (size + static_cast<sizeType>(
-                                                Deque::preserveSize
-                                             )) / static_cast<sizeType>(Deque::bufferSize) + (
-                    static_cast<sizeType>(not(size + static_cast<sizeType>(Deque::preserveSize)) %
-                            static_cast<sizeType>(Deque::bufferSize) == static_cast<sizeType>(0)
-                    )
-                );
-}
-template <typename T, typename Allocator, unsigned long BufferSize>
-inline void DataStructure::Deque<T, Allocator, BufferSize>::initBuffer(sizeType size) {
-    while(size < this->bufferNumber) {
-        this->buffer[size++].allocate(static_cast<sizeType>(bufferSize));
+DataStructure::Deque<T, Allocator, BufferSize>::bufferBytes() noexcept {
+    return sizeof(valueType) * static_cast<sizeType>(bufferSize) < sizeof(pointer) ? sizeof(pointer) :
+            sizeof(valueType) * static_cast<sizeType>(bufferSize);
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+inline typename DataStructure::Deque<T, Allocator, BufferSize>::pointer
+DataStructure::Deque<T, Allocator, BufferSize>::allocateBuffer() {
+    __DATA_STRUCTURE_STATISTICS_COUNT(Deque, ADD_BUFFER);
+    __DATA_STRUCTURE_STATISTICS_COUNT(Deque, ALLOCATE);
+    return static_cast<pointer>(allocator::operator new (Deque::bufferBytes()));
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+inline void DataStructure::Deque<T, Allocator, BufferSize>::deallocateBuffer(pointer p) noexcept {
+    allocator::operator delete (p, Deque::bufferBytes());
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+inline typename DataStructure::Deque<T, Allocator, BufferSize>::map
+DataStructure::Deque<T, Allocator, BufferSize>::allocateMap(sizeType size) {
+    auto newBuffer {static_cast<map>(::operator new (sizeof(pointer) * size))};
+    __DATA_STRUCTURE_STATISTICS_COUNT(Deque, ALLOCATE);
+    for(auto i {static_cast<sizeType>(0)}; i < size; ++i) {
+        newBuffer[i] = nullptr;
     }
+    return newBuffer;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-inline void DataStructure::Deque<T, Allocator, BufferSize>::free() noexcept(
-        static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+template <typename InputIterator>
+inline void DataStructure::Deque<T, Allocator, BufferSize>::copySegment(
+        pointer position, InputIterator &first, sizeType size, __DataStructure_trueType
+) noexcept {
+    std::memcpy(position, first, sizeof(valueType) * size);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT_N(Deque, constReference, size);
+    first += size;
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+template <typename InputIterator>
+inline void DataStructure::Deque<T, Allocator, BufferSize>::copySegment(
+        pointer position, InputIterator &first, sizeType size, __DataStructure_falseType
 ) {
-    delete[] this->buffer;
+    auto cursor {position};
+    try {
+        for(; size; --size, static_cast<void>(++cursor), static_cast<void>(++first)) {
+            new (cursor) valueType(*first);
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, constReference);
+        }
+    }catch(...) {
+        while(cursor not_eq position) {
+            allocator::destroy(static_cast<void *>(--cursor));
+            __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
+        }
+        throw;
+    }
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-inline typename DataStructure::Deque<T, Allocator, BufferSize>::__Deque_CheckParameter
-DataStructure::Deque<T, Allocator, BufferSize>::checkReserve(sizeType size, bool headFirstly) const noexcept {
-    if(headFirstly) {
-        if(this->first - iterator(this->buffer->begin(), this->buffer) > size) {
-            return __Deque_CheckParameter::HEAD_SUCCESSFUL;
+inline void DataStructure::Deque<T, Allocator, BufferSize>::fillSegment(
+        pointer position, sizeType size, constReference value
+) {
+    auto cursor {position};
+    try {
+        for(; size; --size, static_cast<void>(++cursor)) {
+            new (cursor) valueType(value);
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, constReference);
         }
-        auto lastBuffer {this->buffer + static_cast<differenceType>(this->bufferNumber - 1)};
-        if(iterator(lastBuffer->end(), lastBuffer) - this->last) {
-            return __Deque_CheckParameter::TAIL_SUCCESSFUL;
+    }catch(...) {
+        while(cursor not_eq position) {
+            allocator::destroy(static_cast<void *>(--cursor));
+            __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
         }
-        return __Deque_CheckParameter::ALL_FAILED;
+        throw;
     }
-    auto lastBuffer {this->buffer + static_cast<differenceType>(this->bufferNumber - 1)};
-    if(static_cast<sizeType>(iterator(lastBuffer->end(), lastBuffer) - this->last) > size) {
-        return __Deque_CheckParameter::TAIL_SUCCESSFUL;
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+template <typename Function>
+void DataStructure::Deque<T, Allocator, BufferSize>::constructAuxiliary(
+        iterator &cursor, sizeType size, Function construct
+) {
+    while(size) {
+        const auto vacancy {static_cast<sizeType>(bufferSize) - static_cast<sizeType>(cursor.iterator - cursor.first)};
+        const auto number {size < vacancy ? size : vacancy};
+        construct(cursor.iterator, number);
+        size -= number;
+        if(number == vacancy) {
+            cursor.setNode(cursor.node + 1);
+            cursor.iterator = cursor.first;
+        }else {
+            cursor.iterator += number;
+        }
     }
-    if(static_cast<sizeType>(this->first - iterator(this->buffer->begin(), this->buffer) + 1) > size) {
-        return __Deque_CheckParameter::HEAD_SUCCESSFUL;
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+inline typename DataStructure::Deque<T, Allocator, BufferSize>::pointer
+DataStructure::Deque<T, Allocator, BufferSize>::acquireBuffer() {
+    if(not this->cache) {
+        return Deque::allocateBuffer();
     }
-    return __Deque_CheckParameter::ALL_FAILED;
+    const auto newBuffer {this->cache};
+    this->cache = *reinterpret_cast<pointer *>(newBuffer);
+    --this->cacheNumber;
+    return newBuffer;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-template <typename Type>
-inline void DataStructure::Deque<T, Allocator, BufferSize>::insertBackwardAuxiliary(
-        Type value, sizeType size, iterator insertPosition
-) {
-    auto newLast {this->last + static_cast<differenceType>(size)};
-    auto cursor {newLast - static_cast<differenceType>(1)};
-    auto moveCursor {this->last - static_cast<differenceType>(1)};
-    while(moveCursor >= insertPosition) {
-        --cursor.construct(move(*moveCursor));
-        --moveCursor.destroy();
+inline void DataStructure::Deque<T, Allocator, BufferSize>::recycleBuffer(pointer p) noexcept {
+    if(this->cacheNumber >= this->highWaterMark) {
+        Deque::deallocateBuffer(p);
+        return;
     }
-    this->last = newLast;
-    while(size--) {
-        ++insertPosition.construct(value);
+    *reinterpret_cast<pointer *>(p) = this->cache;
+    this->cache = p;
+    ++this->cacheNumber;
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+void DataStructure::Deque<T, Allocator, BufferSize>::freeCache() noexcept {
+    while(this->cache) {
+        const auto next {*reinterpret_cast<pointer *>(this->cache)};
+        Deque::deallocateBuffer(this->cache);
+        this->cache = next;
     }
+    this->cacheNumber = 0;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-template <typename Type>
-inline void DataStructure::Deque<T, Allocator, BufferSize>::insertForwardAuxiliary(
-        Type value, sizeType size, iterator insertPosition
+void DataStructure::Deque<T, Allocator, BufferSize>::initBuffer(sizeType size) {
+    const auto nodeNumber {(size + 1) / static_cast<sizeType>(bufferSize) + 1};
+    this->bufferNumber = nodeNumber + static_cast<sizeType>(Deque::preserveSize) >
+            static_cast<sizeType>(Deque::mapSize) ? nodeNumber + static_cast<sizeType>(Deque::preserveSize) :
+            static_cast<sizeType>(Deque::mapSize);
+    this->buffer = Deque::allocateMap(this->bufferNumber);
+    auto start {this->buffer + static_cast<differenceType>((this->bufferNumber - nodeNumber) / 2)};
+    try {
+        for(auto i {static_cast<sizeType>(0)}; i < nodeNumber; ++i) {
+            start[i] = Deque::allocateBuffer();
+        }
+    }catch(...) {
+        for(auto i {static_cast<sizeType>(0)}; i < nodeNumber and start[i]; ++i) {
+            Deque::deallocateBuffer(start[i]);
+        }
+        ::operator delete (this->buffer);
+        throw;
+    }
+    this->first = iterator(*start, *start, start) +
+            static_cast<differenceType>((nodeNumber * static_cast<sizeType>(bufferSize) - size - 1) / 2);
+    this->last = this->first + static_cast<differenceType>(1);
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+void DataStructure::Deque<T, Allocator, BufferSize>::free() noexcept(
+        static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
-    auto newFirst {this->first - static_cast<differenceType>(size)};
-    auto cursor {newFirst + static_cast<differenceType>(1)};
-    auto moveCursor {this->first + static_cast<differenceType>(1)};
-    while(moveCursor not_eq insertPosition) {
-        ++cursor.construct(move(*moveCursor));
-        ++moveCursor.destroy();
+    if(not this->buffer) {
+        return;
     }
-    this->first = newFirst;
-    insertPosition = cursor;
-    while(size--) {
-        ++insertPosition.construct(value);
+    this->clear();
+    for(auto i {static_cast<sizeType>(0)}; i < this->bufferNumber; ++i) {
+        if(this->buffer[i]) {
+            Deque::deallocateBuffer(this->buffer[i]);
+        }
+    }
+    ::operator delete (this->buffer);
+    this->freeCache();
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+void DataStructure::Deque<T, Allocator, BufferSize>::releaseBuffer() noexcept {
+    for(auto cursor {this->buffer}; cursor not_eq this->first.node; ++cursor) {
+        if(*cursor) {
+            this->recycleBuffer(*cursor);
+            *cursor = nullptr;
+        }
+    }
+    for(auto cursor {this->last.node + 1}; cursor not_eq this->buffer + this->bufferNumber; ++cursor) {
+        if(*cursor) {
+            this->recycleBuffer(*cursor);
+            *cursor = nullptr;
+        }
+    }
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+void DataStructure::Deque<T, Allocator, BufferSize>::reallocateMap(sizeType size, bool addToFront) {
+    const auto oldNodeNumber {static_cast<sizeType>(this->last.node - this->first.node + 1)};
+    const auto newNodeNumber {oldNodeNumber + size};
+    this->releaseBuffer();
+    map newStart;
+    if(this->bufferNumber > 2 * newNodeNumber) {
+        newStart = this->buffer + static_cast<differenceType>(
+                (this->bufferNumber - newNodeNumber) / 2 + (addToFront ? size : 0)
+        );
+        std::memmove(newStart, this->first.node, sizeof(pointer) * oldNodeNumber);
+        for(auto cursor {this->buffer}; cursor not_eq newStart; ++cursor) {
+            *cursor = nullptr;
+        }
+        for(auto cursor {newStart + oldNodeNumber}; cursor not_eq this->buffer + this->bufferNumber; ++cursor) {
+            *cursor = nullptr;
+        }
+    }else {
+        const auto newBufferNumber {this->bufferNumber + (this->bufferNumber > size ? this->bufferNumber : size) +
+                static_cast<sizeType>(Deque::preserveSize)};
+        auto newBuffer {Deque::allocateMap(newBufferNumber)};
+        newStart = newBuffer + static_cast<differenceType>(
+                (newBufferNumber - newNodeNumber) / 2 + (addToFront ? size : 0)
+        );
+        std::memcpy(newStart, this->first.node, sizeof(pointer) * oldNodeNumber);
+        ::operator delete (this->buffer);
+        this->buffer = newBuffer;
+        this->bufferNumber = newBufferNumber;
     }
+    this->first.node = newStart;
+    this->last.node = newStart + static_cast<differenceType>(oldNodeNumber - 1);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-inline void DataStructure::Deque<T, Allocator, BufferSize>::addBuffer(sizeType size, bool addToFront) {
-    auto newBufferNumber {Deque::startSize(this->capacity() + size)};
-    auto difference {static_cast<differenceType>(newBufferNumber - this->bufferNumber)};
-    auto newBuffer {new allocator[newBufferNumber]()};
-    auto firstDifference {this->first - iterator(this->buffer->begin(), this->buffer)};
-    auto oldSize {static_cast<differenceType>(this->size() + 1)};
+void DataStructure::Deque<T, Allocator, BufferSize>::addBuffer(sizeType size, bool addToFront) {
     if(addToFront) {
-        for(auto i {
-                        static_cast<sizeType>(difference)
-                   }, j {static_cast<sizeType>(0)}; i < newBufferNumber; ++i) {
-            newBuffer[i] = move(this->buffer[j++]);
+        const auto vacancy {static_cast<sizeType>(this->first.iterator - this->first.first)};
+        if(size <= vacancy) {
+            return;
         }
-        for(auto i {0}; i < difference; ++i) {
-            newBuffer[i].allocate(static_cast<sizeType>(bufferSize));
+        const auto number {
+            (size - vacancy + static_cast<sizeType>(bufferSize) - 1) / static_cast<sizeType>(bufferSize)
+        };
+        if(static_cast<sizeType>(this->first.node - this->buffer) < number) {
+            this->reallocateMap(number, true);
         }
-        auto oldStart {newBuffer + difference};
-        this->first = iterator(oldStart->begin(), oldStart) + firstDifference;
-        this->last = this->first + oldSize;
-        this->bufferNumber = move(newBufferNumber);
-        this->free();
-        this->buffer = move(newBuffer);
+        for(auto cursor {this->first.node - static_cast<differenceType>(number)};
+                cursor not_eq this->first.node; ++cursor) {
+            if(not *cursor) {
+                *cursor = this->acquireBuffer();
+            }
+        }
+        return;
+    }
+    const auto vacancy {
+        static_cast<sizeType>(bufferSize) - static_cast<sizeType>(this->last.iterator - this->last.first) - 1
+    };
+    if(size <= vacancy) {
         return;
     }
-    for(auto i {0}; i < this->bufferNumber; ++i) {
-        newBuffer[i] = move(this->buffer[i]);
+    const auto number {
+        (size - vacancy + static_cast<sizeType>(bufferSize) - 1) / static_cast<sizeType>(bufferSize)
+    };
+    if(static_cast<sizeType>(this->buffer + this->bufferNumber - this->last.node - 1) < number) {
+        this->reallocateMap(number, false);
     }
-    for(auto i {this->bufferNumber}; i < newBufferNumber; ++i) {
-        newBuffer[i].allocate(static_cast<sizeType>(bufferSize));
+    const auto end {this->last.node + static_cast<differenceType>(number + 1)};
+    for(auto cursor {this->last.node + 1}; cursor not_eq end; ++cursor) {
+        if(not *cursor) {
+            *cursor = this->acquireBuffer();
+        }
     }
-    this->first = iterator(newBuffer->begin(), newBuffer) + firstDifference;
-    this->last = this->first + oldSize;
-    this->bufferNumber = move(newBufferNumber);
-    this->free();
-    this->buffer = move(newBuffer);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-template <typename Type>
-inline typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
-DataStructure::Deque<T, Allocator, BufferSize>::insertAuxiliary(
-        differenceType index, Type value, sizeType size, bool backward
-) {
-    auto insertPosition {this->begin() + index};
-    if(backward) {
-        switch(this->checkReserve(size)) {
-            case __Deque_CheckParameter::TAIL_SUCCESSFUL:
-                this->insertBackwardAuxiliary<Type>(value, size, insertPosition);
-                return insertPosition;
-            case __Deque_CheckParameter::HEAD_SUCCESSFUL:
-                this->insertForwardAuxiliary<Type>(value, size, insertPosition);
-                return insertPosition - size;
-            default:
-                break;
-        }
+typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
+DataStructure::Deque<T, Allocator, BufferSize>::makeGap(differenceType index, sizeType size) {
+    if(static_cast<sizeType>(index) >= this->size() - static_cast<sizeType>(index)) {
         this->addBuffer(size);
-        insertPosition = this->begin() + index;
-        this->insertBackwardAuxiliary<Type>(value, size, insertPosition);
-        return insertPosition;
-    }
-    switch(this->checkReserve(size, true)) {
-        case __Deque_CheckParameter::HEAD_SUCCESSFUL:
-            this->insertForwardAuxiliary<Type>(value, size, insertPosition);
-            return insertPosition - size;
-        case __Deque_CheckParameter::TAIL_SUCCESSFUL:
-            this->insertBackwardAuxiliary<Type>(value, size, insertPosition);
-            return insertPosition;
-        default:
-            break;
+        const auto position {this->begin() + index};
+        const auto newLast {this->last + static_cast<differenceType>(size)};
+        auto cursor {newLast};
+        auto moveCursor {this->last};
+        while(moveCursor not_eq position) {
+            new (&*--cursor) valueType(move(*--moveCursor));
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, rightValueReference);
+            allocator::destroy(static_cast<void *>(moveCursor.iterator));
+            __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
+        }
+        this->last = newLast;
+        return position;
     }
     this->addBuffer(size, true);
-    insertPosition = this->begin() + index;
-    this->insertForwardAuxiliary<Type>(value, size, insertPosition);
-    return insertPosition - size;
-}
-template <typename T, typename Allocator, unsigned long BufferSize>
-template <typename InputIterator,
-                typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
->
-inline void DataStructure::Deque<T, Allocator, BufferSize>::insertForwardAuxiliaryForIterator(
-        typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last,
-        iterator insertPosition, sizeType size
-) {
-    auto newFirst {this->first - static_cast<differenceType>(size)};
+    const auto position {this->begin() + index};
+    const auto newFirst {this->first - static_cast<differenceType>(size)};
     auto cursor {newFirst + static_cast<differenceType>(1)};
-    auto moveCursor {this->first + static_cast<differenceType>(1)};
-    while(moveCursor not_eq insertPosition) {
-        ++cursor.construct(move(*moveCursor));
-        ++moveCursor.destroy();
+    auto moveCursor {this->begin()};
+    while(moveCursor not_eq position) {
+        new (&*cursor++) valueType(move(*moveCursor));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, rightValueReference);
+        allocator::destroy(static_cast<void *>(moveCursor++.iterator));
+        __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
     }
     this->first = newFirst;
-    insertPosition = cursor;
-    while(first not_eq last) {
-        ++insertPosition.construct(static_cast<valueType>(*first++));
-    }
+    return cursor;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-template <typename InputIterator,
-            typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
->
-inline void DataStructure::Deque<T, Allocator, BufferSize>::insertBackwardAuxiliaryForIterator(
-        typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last,
-        iterator insertPosition, sizeType size
+template <typename Type>
+inline typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
+DataStructure::Deque<T, Allocator, BufferSize>::insertAuxiliary(
+        differenceType index, Type value, sizeType size
 ) {
-    auto newLast {this->last + static_cast<differenceType>(size)};
-    auto cursor {newLast - static_cast<differenceType>(1)};
-    auto moveCursor {this->last - static_cast<differenceType>(1)};
-    while(moveCursor >= insertPosition) {
-        --cursor.construct(move(*moveCursor));
-        --moveCursor.destroy();
-    }
-    this->last = newLast;
-    while(first not_eq last) {
-        ++insertPosition.construct(static_cast<valueType>(*first++));
+    const auto position {this->makeGap(index, size)};
+    auto cursor {position};
+    while(--size) {
+        new (&*cursor++) valueType(value);
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, constReference);
     }
+    new (&*cursor) valueType(forward<Type>(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, Type);
+    return position;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 template <typename InputIterator,
@@ -400,41 +527,16 @@ template <typename InputIterator,
 inline typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::insertAuxiliaryForIterator(
         differenceType index,
-        typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last,
-        bool backward
+        typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
 ) {
-    auto insertPosition {this->begin() + index};
     const auto size {IteratorDifference<InputIterator>()(first, last)};
-    if(backward) {
-        switch(this->checkReserve(size)) {
-            case __Deque_CheckParameter::TAIL_SUCCESSFUL:
-                this->insertBackwardAuxiliaryForIterator(first, last, insertPosition, size);
-                return insertPosition;
-            case __Deque_CheckParameter::HEAD_SUCCESSFUL:
-                this->insertForwardAuxiliaryForIterator(first, last, insertPosition, size);
-                return insertPosition - size;
-            default:
-                break;
-        }
-        this->addBuffer(size);
-        insertPosition = this->begin() + index;
-        this->insertBackwardAuxiliaryForIterator(first, last, insertPosition, size);
-        return insertPosition;
-    }
-    switch(this->checkReserve(size, true)) {
-        case __Deque_CheckParameter::HEAD_SUCCESSFUL:
-            this->insertForwardAuxiliaryForIterator(first, last, insertPosition, size);
-            return insertPosition - size;
-        case __Deque_CheckParameter::TAIL_SUCCESSFUL:
-            this->insertBackwardAuxiliaryForIterator(first, last, insertPosition, size);
-            return insertPosition;
-        default:
-            break;
+    const auto position {this->makeGap(index, static_cast<sizeType>(size))};
+    auto cursor {position};
+    while(first not_eq last) {
+        new (&*cursor++) valueType(*first++);
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, constReference);
     }
-    this->addBuffer(size, true);
-    insertPosition = this->begin() + index;
-    this->insertForwardAuxiliaryForIterator(first, last, insertPosition, size);
-    return insertPosition - size;
+    return position;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 inline void DataStructure::Deque<T, Allocator, BufferSize>::eraseBackwardAuxiliary(
@@ -442,100 +544,83 @@ inline void DataStructure::Deque<T, Allocator, BufferSize>::eraseBackwardAuxilia
 ) {
     auto erasePosition {this->begin() + index};
     auto cursor {erasePosition};
-    for(auto i {0}; i < size; ++i) {
-        ++cursor.destroy();
+    for(auto i {static_cast<sizeType>(0)}; i < size; ++i) {
+        allocator::destroy(static_cast<void *>(cursor++.iterator));
+        __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
     }
     while(cursor not_eq this->last) {
-        ++erasePosition.construct(move(*cursor));
-        ++cursor.destroy();
+        new (&*erasePosition++) valueType(move(*cursor));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, rightValueReference);
+        allocator::destroy(static_cast<void *>(cursor++.iterator));
+        __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
     }
-    this->last -= static_cast<differenceType>(size);
-    this->shrink();
+    this->last = erasePosition;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 inline void DataStructure::Deque<T, Allocator, BufferSize>::eraseForwardAuxiliary(
         differenceType index, sizeType size
 ) {
-    auto erasePosition {this->begin() + static_cast<differenceType>(index)};
-    --size;
-    auto cursor {erasePosition + static_cast<differenceType>(size)};
-    while(cursor >= erasePosition) {
-        --cursor.destroy();
+    auto erasePosition {this->begin() + static_cast<differenceType>(index + size - 1)};
+    auto cursor {erasePosition};
+    for(auto i {static_cast<sizeType>(0)}; i < size; ++i) {
+        allocator::destroy(static_cast<void *>(cursor--.iterator));
+        __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
     }
-    erasePosition += static_cast<differenceType>(size);
     while(cursor not_eq this->first) {
-        --erasePosition.construct(move(*cursor));
-        --cursor.destroy();
+        new (&*erasePosition--) valueType(move(*cursor));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, rightValueReference);
+        allocator::destroy(static_cast<void *>(cursor--.iterator));
+        __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
     }
-    this->first = move(erasePosition);
-    this->shrink(true);
+    this->first = erasePosition;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 template <typename Type>
 inline void DataStructure::Deque<T, Allocator, BufferSize>::pushBackAuxiliary(Type value) {
-    const auto lastBuffer {
-        this->buffer + static_cast<differenceType>(this->bufferNumber - static_cast<sizeType>(1))
-    };
-    if(this->last == iterator(lastBuffer->end() - static_cast<differenceType>(1), lastBuffer)) {
+    if(this->last.iterator - this->last.first == static_cast<differenceType>(bufferSize) - 1) {
         this->addBuffer(static_cast<sizeType>(1));
     }
-    ++this->last.construct(value);
+    new (this->last.iterator) valueType(forward<Type>(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, Type);
+    ++this->last;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 template <typename Type>
 inline void DataStructure::Deque<T, Allocator, BufferSize>::pushFrontAuxiliary(Type value) {
-    if(this->first == iterator(this->buffer->begin(), this->buffer)) {
+    if(this->first.iterator == this->first.first) {
         this->addBuffer(static_cast<sizeType>(1), true);
     }
-    --this->first.construct(value);
-}
-template <typename T, typename Allocator, unsigned long BufferSize>
-inline void DataStructure::Deque<T, Allocator, BufferSize>::shrink(bool head) {
-    auto oldSize {static_cast<differenceType>(this->size() + 1)};
-    auto size {static_cast<sizeType>(0)};
-    if(head) {
-        auto maxIndex {this->bufferNumber - 1};
-        for(auto i {0}; i < maxIndex; ++i) {
-            auto buffer {this->buffer + static_cast<differenceType>(i)};
-            if(iterator(buffer->end(), buffer) < this->first) {
-                ++size;
-                continue;
-            }
-            break;
-        }
-        auto lastBuffer {this->buffer + static_cast<differenceType>(maxIndex)};
-        auto lastOffset {iterator(lastBuffer->end(), lastBuffer) - this->last};
-        auto newBufferNumber {this->bufferNumber - size};
-        auto newBuffer {new allocator[newBufferNumber]()};
-        for(sizeType i {0}, j {size}; i < newBufferNumber; ++i, ++j) {
-            newBuffer[i] = move(this->buffer[j]);
+    new (this->first.iterator) valueType(forward<Type>(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Deque, Type);
+    --this->first;
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+template <typename Function>
+bool DataStructure::Deque<T, Allocator, BufferSize>::forEachSegmentPair(const Deque &rhs, Function function) const {
+    auto lhsCursor {this->begin()};
+    auto rhsCursor {rhs.begin()};
+    const auto lhsSize {this->size()};
+    const auto rhsSize {rhs.size()};
+    auto size {lhsSize < rhsSize ? lhsSize : rhsSize};
+    while(size) {
+        const auto lhsVacancy {
+            static_cast<sizeType>(bufferSize) - static_cast<sizeType>(lhsCursor.iterator - lhsCursor.first)
+        };
+        const auto rhsVacancy {
+            static_cast<sizeType>(bufferSize) - static_cast<sizeType>(rhsCursor.iterator - rhsCursor.first)
+        };
+        auto number {lhsVacancy < rhsVacancy ? lhsVacancy : rhsVacancy};
+        if(size < number) {
+            number = size;
         }
-        this->buffer = move(newBuffer);
-        this->bufferNumber = move(newBufferNumber);
-        lastBuffer = this->buffer + static_cast<differenceType>(this->bufferNumber - 1);
-        this->last = iterator(lastBuffer->end() - lastOffset, lastBuffer);
-        this->first = this->last - oldSize;
-        return;
-    }
-    for(auto i {this->bufferNumber - 1}; i > 0; --i) {
-        auto buffer {this->buffer + static_cast<differenceType>(i)};
-        if(this->last < iterator(buffer->begin(), buffer)) {
-            ++size;
-            continue;
+        if(not function(lhsCursor.iterator, rhsCursor.iterator, number)) {
+            return false;
         }
-        break;
-    }
-    auto firstOffset {this->first - iterator(this->buffer->begin(), this->buffer)};
-    auto newBufferNumber {this->bufferNumber - size};
-    auto newBuffer {new allocator[newBufferNumber]()};
-    for(auto i {0}; i < newBufferNumber; ++i) {
-        newBuffer[i] = move(this->buffer[i]);
+        lhsCursor += static_cast<differenceType>(number);
+        rhsCursor += static_cast<differenceType>(number);
+        size -= number;
     }
-    this->free();
-    this->buffer = move(newBuffer);
-    this->bufferNumber = move(newBufferNumber);
-    this->first = iterator(this->buffer->begin() + firstOffset, this->buffer);
-    this->last = this->first + oldSize;
+    return true;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 DataStructure::Deque<T, Allocator, BufferSize>::Deque() : Deque(static_cast<sizeType>(0)) {}
@@ -543,18 +628,14 @@ template <typename T, typename Allocator, unsigned long BufferSize>
 DataStructure::Deque<T, Allocator, BufferSize>::Deque(sizeType size) : Deque(size, valueType()) {}
 template <typename T, typename Allocator, unsigned long BufferSize>
 DataStructure::Deque<T, Allocator, BufferSize>::Deque(sizeType size, constReference value) :
-        bufferNumber {
-            Deque::startSize(size + static_cast<sizeType>(Deque::bufferSize / 2 - Deque::preserveSize))
-        } ,
-        buffer {new allocator[this->bufferNumber]()},
-        last {iterator(
-                this->buffer->allocate(static_cast<sizeType>(bufferSize)) +
-                static_cast<differenceType>(Deque::bufferSize / 2), this->buffer
-              )},
-        first {this->last - static_cast<differenceType>(1)} {
-    this->initBuffer(static_cast<sizeType>(1));
-    while(size--) {
-        ++this->last.construct(value);
+        bufferNumber {0}, buffer {nullptr}, last {}, first {}, cache {nullptr}, cacheNumber {0},
+        highWaterMark {static_cast<sizeType>(Deque::cacheSize)} {
+    this->initBuffer(size);
+    try {
+        this->pushBackN(size, value);
+    }catch(...) {
+        this->free();
+        throw;
     }
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
@@ -563,18 +644,14 @@ template <typename InputIterator,
 >
 DataStructure::Deque<T, Allocator, BufferSize>::Deque(
         typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last) :
-        bufferNumber {Deque::startSize(IteratorDifference<InputIterator>()(first, last) +
-                        static_cast<sizeType>(Deque::bufferSize / 2 - Deque::preserveSize))
-        },
-        buffer {new allocator[this->bufferNumber]()},
-        last {iterator(
-                this->buffer->allocate(static_cast<sizeType>(bufferSize)) +
-                static_cast<differenceType>(Deque::bufferSize / 2), this->buffer
-              )},
-        first {this->last - static_cast<differenceType>(1)} {
-    this->initBuffer(static_cast<differenceType>(1));
-    while(first not_eq last) {
-        ++this->last.construct(static_cast<valueType>(*first++));
+        bufferNumber {0}, buffer {nullptr}, last {}, first {}, cache {nullptr}, cacheNumber {0},
+        highWaterMark {static_cast<sizeType>(Deque::cacheSize)} {
+    this->initBuffer(static_cast<sizeType>(IteratorDifference<InputIterator>()(first, last)));
+    try {
+        this->appendRange(first, last);
+    }catch(...) {
+        this->free();
+        throw;
     }
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
@@ -582,12 +659,25 @@ DataStructure::Deque<T, Allocator, BufferSize>::Deque(std::initializer_list<valu
         Deque(list.begin(), list.end()) {}
 template <typename T, typename Allocator, unsigned long BufferSize>
 DataStructure::Deque<T, Allocator, BufferSize>::Deque(const Deque &rhs) :
-        Deque(rhs.cbegin(), rhs.cend()) {}
+        bufferNumber {0}, buffer {nullptr}, last {}, first {}, cache {nullptr}, cacheNumber {0},
+        highWaterMark {rhs.highWaterMark} {
+    this->initBuffer(rhs.size());
+    try {
+        rhs.forEachSegment([this](pointer segment, sizeType size) -> void {
+            this->appendRange(segment, segment + size);
+        });
+    }catch(...) {
+        this->free();
+        throw;
+    }
+}
 template <typename T, typename Allocator, unsigned long BufferSize>
 DataStructure::Deque<T, Allocator, BufferSize>::Deque(Deque &&rhs) noexcept :
-        bufferNumber {rhs.bufferNumber}, buffer {rhs.buffer},
-        last {rhs.last}, first {rhs.first} {
+        bufferNumber {rhs.bufferNumber}, buffer {rhs.buffer}, last {rhs.last}, first {rhs.first},
+        cache {rhs.cache}, cacheNumber {rhs.cacheNumber}, highWaterMark {rhs.highWaterMark} {
     rhs.buffer = nullptr;
+    rhs.cache = nullptr;
+    rhs.cacheNumber = 0;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 DataStructure::Deque<T, Allocator, BufferSize>::~Deque() {
@@ -596,27 +686,11 @@ DataStructure::Deque<T, Allocator, BufferSize>::~Deque() {
 template <typename T, typename Allocator, unsigned long BufferSize>
 DataStructure::Deque<T, Allocator, BufferSize> &
 DataStructure::Deque<T, Allocator, BufferSize>::operator=(const Deque &rhs) {
-    auto temp {move(this->buffer)};
-    try {
-        this->buffer = new allocator[rhs.bufferNumber]();
-    }catch(...) {
-        this->buffer = move(temp);
-        throw;
-    }
-    delete[] temp;
-    this->bufferNumber = rhs.bufferNumber;
-    auto firstTemp {move(this->first)};
-    try {
-        this->first = iterator(this->buffer.allocate(static_cast<sizeType>(bufferSize)), this->buffer) + (
-                rhs.first - iterator(rhs.buffer->begin(), rhs.buffer)
-        );
-    }catch(...) {
-        this->first = move(firstTemp);
-        throw;
-    }
-    this->last = this->first + static_cast<differenceType>(1);
-    for(auto &c : rhs) {
-        ++this->last.construct(c);
+    if(this not_eq &rhs) {
+        this->clear();
+        rhs.forEachSegment([this](pointer segment, sizeType size) -> void {
+            this->appendRange(segment, segment + size);
+        });
     }
     return *this;
 }
@@ -631,19 +705,25 @@ DataStructure::Deque<T, Allocator, BufferSize>::operator=(Deque &&rhs) noexcept
     this->buffer = rhs.buffer;
     this->first = rhs.first;
     this->last = rhs.last;
+    this->cache = rhs.cache;
+    this->cacheNumber = rhs.cacheNumber;
+    this->highWaterMark = rhs.highWaterMark;
     rhs.buffer = nullptr;
+    rhs.cache = nullptr;
+    rhs.cacheNumber = 0;
     return *this;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 DataStructure::Deque<T, Allocator, BufferSize> &
 DataStructure::Deque<T, Allocator, BufferSize>::operator=(std::initializer_list<valueType> list) {
-    *this = Deque(list.begin(), list.end());
+    this->assign(list.begin(), list.end());
     return *this;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::reference
 DataStructure::Deque<T, Allocator, BufferSize>::operator[](differenceType index) & {
-    return this->first[++index];
+    const auto offset {static_cast<sizeType>(index + 1 + (this->first.iterator - this->first.first))};
+    return this->first.node[offset >> iterator::shift][offset & static_cast<sizeType>(iterator::mask)];
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::constReference
@@ -652,16 +732,15 @@ DataStructure::Deque<T, Allocator, BufferSize>::operator[](differenceType index)
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 bool DataStructure::Deque<T, Allocator, BufferSize>::operator==(const Deque &rhs) const noexcept {
-    return this->size() == rhs.size() and [](const Deque &lhs, const Deque &rhs) -> bool {
-        auto lhsEnd {lhs.cend()};
-        for(auto rhsIt {rhs.cbegin()}, lhsIt {lhs.cbegin()}; lhsIt not_eq lhsEnd; ++rhsIt, ++lhsIt) {
-            if(*lhsIt == *rhsIt) {
-                continue;
+    return this->size() == rhs.size() and this->forEachSegmentPair(rhs,
+            [](constPointer lhsSegment, constPointer rhsSegment, sizeType size) -> bool {
+        for(auto i {static_cast<sizeType>(0)}; i < size; ++i) {
+            if(not(lhsSegment[i] == rhsSegment[i])) {
+                return false;
             }
-            return false;
         }
         return true;
-    }(*this, rhs);
+    });
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 bool DataStructure::Deque<T, Allocator, BufferSize>::operator!=(const Deque &rhs) const noexcept {
@@ -669,26 +748,18 @@ bool DataStructure::Deque<T, Allocator, BufferSize>::operator!=(const Deque &rhs
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 bool DataStructure::Deque<T, Allocator, BufferSize>::operator<(const Deque &rhs) const noexcept {
-    const auto lhsSize {this->size()};
-    const auto rhsSize {rhs.size()};
-    if(lhsSize <= rhsSize) {
-        auto lhsEnd {this->cend()};
-        for(auto rhsIt {rhs.cbegin()}, lhsIt {this->cbegin()}; lhsIt not_eq lhsEnd; ++rhsIt, ++lhsIt) {
-            if(*lhsIt == *rhsIt) {
+    auto result {this->size() <= rhs.size()};
+    this->forEachSegmentPair(rhs, [&result](constPointer lhsSegment, constPointer rhsSegment, sizeType size) -> bool {
+        for(auto i {static_cast<sizeType>(0)}; i < size; ++i) {
+            if(lhsSegment[i] == rhsSegment[i]) {
                 continue;
             }
-            return *lhsIt < *rhsIt;
+            result = lhsSegment[i] < rhsSegment[i];
+            return false;
         }
         return true;
-    }
-    auto rhsEnd {rhs.cend()};
-    for(auto rhsIt {rhs.cbegin()}, lhsIt {this->cbegin()}; rhsIt not_eq rhsEnd; ++rhsIt, ++lhsIt) {
-        if(*lhsIt == *rhsIt) {
-            continue;
-        }
-        return *lhsIt < *rhsIt;
-    }
-    return false;
+    });
+    return result;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 bool DataStructure::Deque<T, Allocator, BufferSize>::operator<=(const Deque &rhs) const noexcept {
@@ -726,25 +797,8 @@ DataStructure::Deque<T, Allocator, BufferSize>::operator bool() const noexcept {
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 void DataStructure::Deque<T, Allocator, BufferSize>::assign(sizeType size, constReference value) {
-    if(this->checkReserve(size) not_eq __Deque_CheckParameter::TAIL_SUCCESSFUL) {
-        this->addBuffer(size);
-    }
-    auto cursor {this->first + static_cast<differenceType>(1)};
-    while(size and cursor not_eq this->last) {
-        cursor.destroy();
-        ++cursor.construct(value);
-        --size;
-    }
-    if(size) {
-        while(size--) {
-            ++this->last.construct(value);
-        }
-        return;
-    }
-    while(this->last not_eq cursor) {
-        --this->last.destroy();
-    }
-    this->shrink();
+    this->clear();
+    this->pushBackN(size, value);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 template <typename InputIterator,
@@ -753,25 +807,8 @@ template <typename InputIterator,
 void DataStructure::Deque<T, Allocator, BufferSize>::assign(
         typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
 ) {
-    auto size {IteratorDifference<InputIterator>()(first, last)};
-    if(this->checkReserve(size) not_eq __Deque_CheckParameter::TAIL_SUCCESSFUL) {
-        this->addBuffer(size);
-    }
-    auto cursor {this->first + static_cast<differenceType>(1)};
-    while(first not_eq last and cursor not_eq this->last) {
-        cursor.destroy();
-        ++cursor.construct(static_cast<valueType>(*first++));
-    }
-    if(first not_eq last) {
-        while(first not_eq last) {
-            ++this->last.construct(static_cast<valueType>(*first++));
-        }
-        return;
-    }
-    while(this->last not_eq cursor) {
-        --this->last.destroy();
-    }
-    this->shrink();
+    this->clear();
+    this->appendRange(first, last);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 void DataStructure::Deque<T, Allocator, BufferSize>::assign(std::initializer_list<valueType> list) {
@@ -840,44 +877,25 @@ DataStructure::Deque<T, Allocator, BufferSize>::size() const noexcept {
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::sizeType
 DataStructure::Deque<T, Allocator, BufferSize>::capacity() const noexcept {
-    sizeType count {0};
-    for(auto i {0}; i < this->bufferNumber; ++i) {
-        count += this->buffer[i].capacity();
+    auto count {this->cacheNumber * static_cast<sizeType>(bufferSize)};
+    for(auto i {static_cast<sizeType>(0)}; i < this->bufferNumber; ++i) {
+        if(this->buffer[i]) {
+            count += static_cast<sizeType>(bufferSize);
+        }
     }
     return count - static_cast<sizeType>(Deque::preserveSize);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::sizeType
 DataStructure::Deque<T, Allocator, BufferSize>::reserve() const noexcept {
-    auto lastBuffer {this->buffer + (this->bufferNumber - 1)};
-    return this->first - iterator(this->buffer->begin(), this->buffer) + static_cast<sizeType>(1) +
-                (iterator(lastBuffer->end(), lastBuffer) - this->last) - static_cast<sizeType>(preserveSize);
+    return this->capacity() - this->size();
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::resize(sizeType size) {
-    if(size <= static_cast<sizeType>(Deque::bufferSize) * this->bufferNumber) {
-        return this->begin();
+    if(size > this->size()) {
+        this->addBuffer(size - this->size());
     }
-    auto newBufferNumber {Deque::startSize(size)};
-    auto newBuffer {new allocator[newBufferNumber]()};
-    auto newFirst {
-            iterator(newBuffer->allocate(static_cast<sizeType>(bufferSize)) +
-            static_cast<differenceType>(1), newBuffer)
-    };
-    auto newLast {newFirst + static_cast<differenceType>(1)};
-    for(auto i {1}; i < newBufferNumber; ++i) {
-        newBuffer[i].allocate(static_cast<sizeType>(bufferSize));
-    }
-    while(++this->first not_eq this->last) {
-        ++newLast.construct(move(*this->first));
-        this->first.destroy();
-    }
-    this->free();
-    this->buffer = move(newBuffer);
-    this->bufferNumber = move(newBufferNumber);
-    this->first = move(newFirst);
-    this->last = move(newLast);
     return this->begin();
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
@@ -887,38 +905,19 @@ bool DataStructure::Deque<T, Allocator, BufferSize>::empty() const noexcept {
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::shrinkToFit() {
-    if(not this->reserve()) {
-        return this->begin();
-    }
-    auto newBuffer {new allocator[1ul]()};
-    auto newFirst {
-        iterator(newBuffer->allocate(
-                                this->size() + static_cast<sizeType>(Deque::preserveSize)
-                            ), newBuffer)
-    };
-    auto newLast {newFirst + static_cast<differenceType>(1)};
-    while(++this->first < this->last) {
-        ++newLast.construct(move(*this->first));
-        this->first.destroy();
-    }
-    this->free();
-    this->buffer = move(newBuffer);
-    this->bufferNumber = static_cast<sizeType>(1);
-    this->first = move(newFirst);
-    this->last = move(newLast);
+    this->releaseBuffer();
+    this->freeCache();
     return this->begin();
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 void DataStructure::Deque<T, Allocator, BufferSize>::clear() noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
-    if(this->empty()) {
-        return;
-    }
-    while(--this->last not_eq this->first) {
-        this->last.destroy();
-    }
-    ++this->last;
+    this->forEachSegment([](pointer segment, sizeType size) -> void {
+        allocator::destroy(static_cast<void *>(segment), static_cast<const void *>(segment + size));
+        __DATA_STRUCTURE_STATISTICS_COUNT_N(Deque, DESTROY, size);
+    });
+    this->last = this->first + static_cast<differenceType>(1);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
@@ -928,46 +927,24 @@ DataStructure::Deque<T, Allocator, BufferSize>::insert(
     if(not size) {
         return this->begin() + index;
     }
-    if(not index) {
-        while(size--) {
-            this->pushFront(value);
-        }
-        return this->begin();
-    }else if(index == this->size()) {
-        for(auto i {0}; i < size; ++i) {
-            this->pushBack(value);
-        }
-        return this->end() - static_cast<differenceType>(size);
-    }
-    return static_cast<differenceType>(this->size()) - index <= index ?
-                this->insertAuxiliary<constReference>(index, value, size, true) :
-                this->insertAuxiliary<constReference>(index, value, size, false);
+    return this->insertAuxiliary<constReference>(index, value, size);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::insert(differenceType index, rightValueReference value) {
-    if(not index) {
-        this->pushFront(value);
-        return this->begin();
-    }else if(index == this->size()) {
-        this->pushBack(value);
-        return this->end() - static_cast<differenceType>(1);
-    }
-    return static_cast<differenceType>(this->size()) - index <= index ?
-           this->insertAuxiliary<rightValueReference>(index, move(value), static_cast<sizeType>(1), true) :
-           this->insertAuxiliary<rightValueReference>(index, move(value), static_cast<sizeType>(1), false);
+    return this->insertAuxiliary<rightValueReference>(index, move(value), static_cast<sizeType>(1));
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::insert(
         constIterator position, constReference value, sizeType size
 ) {
-    return this->insert(position - this->first, value, size);
+    return this->insert(position - this->cbegin(), value, size);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::insert(constIterator position, rightValueReference value) {
-    return this->insert(position - this->first, move(value));
+    return this->insert(position - this->cbegin(), move(value));
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 template <typename InputIterator,
@@ -981,20 +958,13 @@ DataStructure::Deque<T, Allocator, BufferSize>::insert(differenceType index,
         return this->begin() + index;
     }
     if(not index) {
-        while(first not_eq last) {
-            this->pushFront(static_cast<valueType>(*first++));
-        }
+        this->prependRange(first, last);
         return this->begin();
-    }else if(index == this->size()) {
-        auto size {IteratorDifference<InputIterator>()(first, last)};
-        while(first not_eq last) {
-            this->pushBack(static_cast<valueType>(*first++));
-        }
-        return this->end() - size;
+    }else if(static_cast<sizeType>(index) == this->size()) {
+        this->appendRange(first, last);
+        return this->begin() + index;
     }
-    return static_cast<differenceType>(this->size()) - index <= index ?
-           this->insertAuxiliaryForIterator(index, first, last, true) :
-           this->insertAuxiliaryForIterator(index, first, last, false);
+    return this->insertAuxiliaryForIterator(index, first, last);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 template <typename InputIterator,
@@ -1004,7 +974,7 @@ typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::insert(constIterator position,
         typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
 ) {
-    return this->insert(position - this->begin(), first, last);
+    return this->insert(position - this->cbegin(), first, last);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
@@ -1018,7 +988,7 @@ typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::insert(
         constIterator position, std::initializer_list<valueType> list
 ) {
-    return this->insert(position - this->begin(), list.begin(), list.end());
+    return this->insert(position - this->cbegin(), list.begin(), list.end());
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
@@ -1031,13 +1001,13 @@ DataStructure::Deque<T, Allocator, BufferSize>::erase(differenceType index, size
             this->popFront();
         }
         return this->begin();
-    }else if(index == this->size()) {
+    }else if(static_cast<sizeType>(index) + size == this->size()) {
         while(size--) {
             this->popBack();
         }
-        return this->end() - static_cast<differenceType>(1);
+        return this->end();
     }
-    this->size() - static_cast<sizeType>(index) + size >= static_cast<sizeType>(index) ?
+    this->size() - static_cast<sizeType>(index) - size <= static_cast<sizeType>(index) ?
             this->eraseBackwardAuxiliary(index, size) :
             this->eraseForwardAuxiliary(index, size);
     return this->begin() + index;
@@ -1045,12 +1015,12 @@ DataStructure::Deque<T, Allocator, BufferSize>::erase(differenceType index, size
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::erase(constIterator position, sizeType size) {
-    return this->erase(position - this->begin(), size);
+    return this->erase(position - this->cbegin(), size);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::erase(constIterator first, constIterator last) {
-    return this->erase(first - this->begin(), last - first);
+    return this->erase(first - this->cbegin(), static_cast<sizeType>(last - first));
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 void DataStructure::Deque<T, Allocator, BufferSize>::pushFront(constReference value) {
@@ -1069,6 +1039,50 @@ void DataStructure::Deque<T, Allocator, BufferSize>::pushBack(rightValueReferenc
     this->pushBackAuxiliary<rightValueReference>(move(value));
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
+void DataStructure::Deque<T, Allocator, BufferSize>::pushBackN(sizeType size, constReference value) {
+    this->addBuffer(size);
+    Deque::constructAuxiliary(this->last, size, [&value](pointer position, sizeType number) -> void {
+        Deque::fillSegment(position, number, value);
+    });
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+template <typename InputIterator,
+                typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
+>
+void DataStructure::Deque<T, Allocator, BufferSize>::appendRange(
+        typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
+) {
+    const auto size {static_cast<sizeType>(IteratorDifference<InputIterator>()(first, last))};
+    this->addBuffer(size);
+    Deque::constructAuxiliary(this->last, size, [&first](pointer position, sizeType number) -> void {
+        Deque::copySegment(position, first, number, isMemoryCopyable<InputIterator>());
+    });
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+template <typename InputIterator,
+                typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
+>
+void DataStructure::Deque<T, Allocator, BufferSize>::prependRange(
+        typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
+) {
+    const auto size {static_cast<sizeType>(IteratorDifference<InputIterator>()(first, last))};
+    this->addBuffer(size, true);
+    const auto newFirst {this->first - static_cast<differenceType>(size)};
+    auto cursor {newFirst + static_cast<differenceType>(1)};
+    try {
+        Deque::constructAuxiliary(cursor, size, [&first](pointer position, sizeType number) -> void {
+            Deque::copySegment(position, first, number, isMemoryCopyable<InputIterator>());
+        });
+    }catch(...) {
+        for(auto destroyCursor {newFirst + static_cast<differenceType>(1)}; destroyCursor not_eq cursor;) {
+            allocator::destroy(static_cast<void *>(destroyCursor++.iterator));
+            __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
+        }
+        throw;
+    }
+    this->first = newFirst;
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
 #ifdef POP_GET_OBJECT
 typename DataStructure::Deque<T, Allocator, BufferSize>::valueType
 #else
@@ -1078,8 +1092,13 @@ DataStructure::Deque<T, Allocator, BufferSize>::popFront() {
 #ifdef POP_GET_OBJECT
     auto temp {move(*this->begin())};
 #endif
-    (++this->first).destroy();
-    this->shrink(true);
+    allocator::destroy(static_cast<void *>((++this->first).iterator));
+    __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
+    if(this->first.iterator == this->first.first) {
+        const auto lastNode {this->first.node - 1};
+        this->recycleBuffer(*lastNode);
+        *lastNode = nullptr;
+    }
 #ifdef POP_GET_OBJECT
     return temp;
 #endif
@@ -1094,8 +1113,13 @@ DataStructure::Deque<T, Allocator, BufferSize>::popBack() {
 #ifdef POP_GET_OBJECT
     auto temp {move(*(this->last - 1))};
 #endif
-    (--this->last).destroy();
-    this->shrink();
+    allocator::destroy(static_cast<void *>((--this->last).iterator));
+    __DATA_STRUCTURE_STATISTICS_COUNT(Deque, DESTROY);
+    if(this->last.iterator - this->last.first == static_cast<differenceType>(bufferSize) - 1) {
+        const auto nextNode {this->last.node + 1};
+        this->recycleBuffer(*nextNode);
+        *nextNode = nullptr;
+    }
 #ifdef POP_GET_OBJECT
     return temp;
 #endif
@@ -1110,7 +1134,7 @@ template <typename T, typename Allocator, unsigned long BufferSize>
 template <typename ...Args>
 typename DataStructure::Deque<T, Allocator, BufferSize>::iterator
 DataStructure::Deque<T, Allocator, BufferSize>::emplace(constIterator position, Args &&...args) {
-    return this->insert(position - this->begin(), valueType(std::forward<Args>(args)...));
+    return this->insert(position - this->cbegin(), valueType(std::forward<Args>(args)...));
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
 template <typename ...Args>
@@ -1133,11 +1157,43 @@ void DataStructure::Deque<T, Allocator, BufferSize>::swap(Deque &rhs) noexcept {
     temp = move(this->last);
     this->last = move(rhs.last);
     rhs.last = move(temp);
+    swap(this->cache, rhs.cache);
+    swap(this->cacheNumber, rhs.cacheNumber);
+    swap(this->highWaterMark, rhs.highWaterMark);
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-typename DataStructure::Deque<T, Allocator, BufferSize>::bufferType
-DataStructure::Deque<T, Allocator, BufferSize>::getAllocator() const & noexcept {
-    return this->buffer;
+template <typename Function>
+void DataStructure::Deque<T, Allocator, BufferSize>::forEachSegment(Function function) const {
+    if(this->empty()) {
+        return;
+    }
+    const auto begin {this->begin()};
+    if(begin.node == this->last.node) {
+        function(begin.iterator, static_cast<sizeType>(this->last.iterator - begin.iterator));
+        return;
+    }
+    function(begin.iterator, static_cast<sizeType>(begin.first + bufferSize - begin.iterator));
+    for(auto cursor {begin.node + 1}; cursor not_eq this->last.node; ++cursor) {
+        function(*cursor, static_cast<sizeType>(bufferSize));
+    }
+    if(this->last.iterator not_eq this->last.first) {
+        function(this->last.first, static_cast<sizeType>(this->last.iterator - this->last.first));
+    }
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+typename DataStructure::Deque<T, Allocator, BufferSize>::sizeType
+DataStructure::Deque<T, Allocator, BufferSize>::getHighWaterMark() const noexcept {
+    return this->highWaterMark;
+}
+template <typename T, typename Allocator, unsigned long BufferSize>
+void DataStructure::Deque<T, Allocator, BufferSize>::setHighWaterMark(sizeType size) noexcept {
+    this->highWaterMark = size;
+    while(this->cacheNumber > size) {
+        const auto next {*reinterpret_cast<pointer *>(this->cache)};
+        Deque::deallocateBuffer(this->cache);
+        this->cache = next;
+        --this->cacheNumber;
+    }
 }
 
 #ifdef DEBUG_DATA_STRUCTURE_FOR_DEQUE
@@ -1147,7 +1203,7 @@ DataStructure::Deque<T, Allocator, BufferSize>::getBufferNumber() & noexcept {
     return this->bufferNumber;
 }
 template <typename T, typename Allocator, unsigned long BufferSize>
-typename DataStructure::Deque<T, Allocator, BufferSize>::bufferType &
+typename DataStructure::Deque<T, Allocator, BufferSize>::map &
 DataStructure::Deque<T, Allocator, BufferSize>::getBuffer() & noexcept {
     return this->buffer;
 }
@@ -27,8 +27,17 @@ namespace DataStructure {
         using node = nodeType *;
     private:
         node first;
+        sizeType count;
+        __DataStructure_NodeSlab<nodeType, allocator, ForwardList> slab;
     private:
-        static node getNewNode();
+        static node getNewFirst();
+        static void deleteFirst(node) noexcept;
+        node getNewNode();
+        void deleteNode(node) noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
     private:
         void free() noexcept(
                 static_cast<bool>(
@@ -43,6 +52,8 @@ namespace DataStructure {
                             InputIterator, node
                     );
         void resetFirst() noexcept;
+        node seek(differenceType) const noexcept;
+        static void transferAfter(node, node, node) noexcept;
     public:
         ForwardList();
         explicit ForwardList(sizeType);
@@ -142,6 +153,22 @@ namespace DataStructure {
                         typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
                 )
         );
+        iterator spliceAfter(constIterator, ForwardList &);
+        iterator spliceAfter(constIterator, ForwardList &, constIterator);
+        iterator spliceAfter(constIterator, ForwardList &, constIterator, constIterator);
+        void merge(ForwardList &);
+        template <typename Compare>
+        void merge(ForwardList &, Compare);
+        void sort();
+        template <typename Compare>
+        void sort(Compare);
+        sizeType unique();
+        template <typename BinaryPredicate>
+        sizeType unique(BinaryPredicate);
+        sizeType remove(constReference);
+        template <typename UnaryPredicate>
+        sizeType removeIf(UnaryPredicate);
+        void reverse() noexcept;
         void swap(ForwardList &) noexcept;
 #ifdef DEBUG_DATA_STRUCTURE_FOR_FORWARD_LIST
         node &getFirst() noexcept;
@@ -158,10 +185,27 @@ void DataStructure::swap(ForwardList<T, Allocator> &lhs, ForwardList<T, Allocato
 
 template <typename T, typename Allocator>
 inline typename DataStructure::ForwardList<T, Allocator>::node
-DataStructure::ForwardList<T, Allocator>::getNewNode() {
+DataStructure::ForwardList<T, Allocator>::getNewFirst() {
+    __DATA_STRUCTURE_STATISTICS_COUNT(ForwardList, ALLOCATE);
     return reinterpret_cast<node>(allocator::operator new (sizeof(nodeType)));
 }
 template <typename T, typename Allocator>
+inline typename DataStructure::ForwardList<T, Allocator>::node DataStructure::ForwardList<T, Allocator>::getNewNode() {
+    return this->slab.allocate();
+}
+template <typename T, typename Allocator>
+inline void DataStructure::ForwardList<T, Allocator>::deleteNode(node p) noexcept(
+        static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+) {
+    allocator::destroy(static_cast<void *>(&p->data));
+    __DATA_STRUCTURE_STATISTICS_COUNT(ForwardList, DESTROY);
+    this->slab.deallocate(p);
+}
+template <typename T, typename Allocator>
+inline void DataStructure::ForwardList<T, Allocator>::deleteFirst(node p) noexcept {
+    allocator::operator delete (p, sizeof(nodeType));
+}
+template <typename T, typename Allocator>
 inline void DataStructure::ForwardList<T, Allocator>::free() noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
@@ -171,8 +215,7 @@ inline void DataStructure::ForwardList<T, Allocator>::free() noexcept(
     auto cursor {this->first->next};
     while(cursor) {
         auto next {cursor->next};
-        allocator::destroy(&cursor->data);
-        delete cursor;
+        this->deleteNode(cursor);
         cursor = next;
     }
 }
@@ -180,26 +223,30 @@ template <typename T, typename Allocator>
 inline void DataStructure::ForwardList<T, Allocator>::setLink(
         sizeType size, constReference value, node first
 ) {
-    auto newNode {ForwardList::getNewNode()};
+    const auto inserted {size};
+    auto newNode {this->getNewNode()};
     const auto backup {newNode};
     while(--size) {
         try {
             new (&newNode->data) valueType(value);
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, constReference);
         }catch(...) {
-            while(backup not_eq newNode) {
-                auto next {backup->next};
-                delete backup;
-                backup = next;
+            for(auto cursor {backup}; cursor not_eq newNode;) {
+                auto next {cursor->next};
+                this->deleteNode(cursor);
+                cursor = next;
             }
-            allocator::operator delete (newNode);
+            this->slab.deallocate(newNode);
             throw;
         }
-        newNode->next = ForwardList::getNewNode();
+        newNode->next = this->getNewNode();
         newNode = newNode->next;
     }
     new (&newNode->data) valueType(value);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, constReference);
     newNode->next = first->next;
     first->next = backup;
+    this->count += inserted;
 }
 template <typename T, typename Allocator>
 template <typename InputIterator,
@@ -209,34 +256,57 @@ inline void DataStructure::ForwardList<T, Allocator>::setLink(
         typename __DataStructure_isInputIterator<InputIterator>::__result first,
         InputIterator last, node firstNode
 ) {
-    auto newNode {ForwardList::getNewNode()};
-    const auto backup {newNode};
     auto size {IteratorDifference<InputIterator>()(first, last)};
+    if(not size) {
+        return;
+    }
+    const auto inserted {static_cast<sizeType>(size)};
+    auto newNode {this->getNewNode()};
+    const auto backup {newNode};
     while(--size) {
         try {
             new (&newNode->data) valueType(static_cast<valueType>(*first++));
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, constReference);
         }catch(...) {
-            while(backup not_eq newNode) {
-                auto next {backup->next};
-                delete backup;
-                backup = next;
+            for(auto cursor {backup}; cursor not_eq newNode;) {
+                auto next {cursor->next};
+                this->deleteNode(cursor);
+                cursor = next;
             }
-            allocator::operator delete (newNode);
+            this->slab.deallocate(newNode);
             throw;
         }
-        newNode->next = ForwardList::getNewNode();
+        newNode->next = this->getNewNode();
         newNode = newNode->next;
     }
     new (&newNode->data) valueType(static_cast<valueType>(*first));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, constReference);
     newNode->next = firstNode->next;
     firstNode->next = backup;
+    this->count += inserted;
 }
 template <typename T, typename Allocator>
 inline void DataStructure::ForwardList<T, Allocator>::resetFirst() noexcept {
     this->first->next = nullptr;
+    this->count = 0;
+}
+template <typename T, typename Allocator>
+inline typename DataStructure::ForwardList<T, Allocator>::node
+DataStructure::ForwardList<T, Allocator>::seek(differenceType index) const noexcept {
+    if(not this->count) {
+        return this->first;
+    }
+    auto offset {static_cast<sizeType>(index)};
+    if(offset >= this->count) {
+        offset = this->count - 1;
+    }
+    auto cursor {this->first->next};
+    for(; offset--; cursor = cursor->next);
+    return cursor;
 }
 template <typename T, typename Allocator>
-DataStructure::ForwardList<T, Allocator>::ForwardList() :first {ForwardList::getNewNode()} {
+DataStructure::ForwardList<T, Allocator>::ForwardList() :
+        first {ForwardList::getNewFirst()}, count {0}, slab {} {
     this->first->next = nullptr;
 }
 template <typename T, typename Allocator>
@@ -270,12 +340,15 @@ DataStructure::ForwardList<T, Allocator>::ForwardList(const ForwardList &rhs) :
 template <typename T, typename Allocator>
 DataStructure::ForwardList<T, Allocator>::ForwardList(ForwardList &&rhs) noexcept : ForwardList() {
     this->first->next = rhs.first->next;
+    this->count = rhs.count;
     rhs.first->next = nullptr;
+    rhs.count = 0;
+    this->slab.swap(rhs.slab);
 }
 template <typename T, typename Allocator>
 DataStructure::ForwardList<T, Allocator>::~ForwardList() {
     this->free();
-    allocator::operator delete (this->first);
+    ForwardList::deleteFirst(this->first);
 }
 template <typename T, typename Allocator>
 DataStructure::ForwardList<T, Allocator> &
@@ -295,8 +368,12 @@ DataStructure::ForwardList<T, Allocator>::operator=(ForwardList &&rhs) noexcept
         return *this;
     }
     this->free();
+    this->slab.release();
     this->first->next = rhs.first->next;
+    this->count = rhs.count;
     rhs.first->next = nullptr;
+    rhs.count = 0;
+    this->slab.swap(rhs.slab);
     return *this;
 }
 template <typename T, typename Allocator>
@@ -384,13 +461,17 @@ void DataStructure::ForwardList<T, Allocator>::assign(sizeType size, constRefere
     auto cursor {this->first};
     while(cursor->next and size) {
         cursor = cursor->next;
-        allocator::destroy(&cursor->data);
+        allocator::destroy(static_cast<void *>(&cursor->data));
+        __DATA_STRUCTURE_STATISTICS_COUNT(ForwardList, DESTROY);
         new (&cursor->data) valueType(value);
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, constReference);
         --size;
     }
     if(size) {
         this->setLink(size, value, cursor);
+        return;
     }
+    this->eraseAfter(constIterator(reinterpret_cast<constNodeType *>(cursor)), this->cend());
 }
 template <typename T, typename Allocator>
 template <typename InputIterator,
@@ -403,13 +484,17 @@ void DataStructure::ForwardList<T, Allocator>::assign(
     auto size {IteratorDifference<InputIterator>()(first, last)};
     while(cursor->next and size) {
         cursor = cursor->next;
-        allocator::destroy(&cursor->data);
+        allocator::destroy(static_cast<void *>(&cursor->data));
+        __DATA_STRUCTURE_STATISTICS_COUNT(ForwardList, DESTROY);
         new (&cursor->data) valueType(static_cast<valueType>(*first++));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, constReference);
         --size;
     }
     if(size) {
         this->setLink(first, last, cursor);
+        return;
     }
+    this->eraseAfter(constIterator(reinterpret_cast<constNodeType *>(cursor)), this->cend());
 }
 template <typename T, typename Allocator>
 void DataStructure::ForwardList<T, Allocator>::assign(std::initializer_list<valueType> list) {
@@ -452,18 +537,12 @@ DataStructure::ForwardList<T, Allocator>::beforeCBegin() const noexcept {
 }
 template <typename T, typename Allocator>
 bool DataStructure::ForwardList<T, Allocator>::empty() const noexcept {
-    return not this->operator bool();
+    return this->count == 0;
 }
 template <typename T, typename Allocator>
 typename DataStructure::ForwardList<T, Allocator>::sizeType
 DataStructure::ForwardList<T, Allocator>::size() const noexcept {
-    auto cursor {this->first->next};
-    sizeType count {0};
-    while(cursor) {
-        ++count;
-        cursor = cursor->next;
-    }
-    return count;
+    return this->count;
 }
 template <typename T, typename Allocator>
 void DataStructure::ForwardList<T, Allocator>::clear() noexcept(
@@ -477,39 +556,38 @@ typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::insertAfter(
         differenceType index, constReference value, sizeType size
 ) {
-    auto cursor {this->first->next};
-    while(index--) {
-        cursor = cursor->next;
-    }
-    this->setLink(size, value, cursor);
-    return iterator(cursor->next);
+    return this->insertAfter(constIterator(reinterpret_cast<constNodeType *>(this->seek(index))), value, size);
 }
 template <typename T, typename Allocator>
 typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::insertAfter(
         constIterator position, constReference value, sizeType size
 ) {
-    return this->insertAfter(IteratorDifference<constIterator>()(this->cbegin(), position), value, size);
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    if(not size) {
+        return iterator(cursor->next);
+    }
+    this->setLink(size, value, cursor);
+    return iterator(cursor->next);
 }
 template <typename T, typename Allocator>
 typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::insertAfter(differenceType index, rightValueReference value) {
-    auto cursor {this->first->next};
-    while(index--) {
-        cursor = cursor->next;
-    }
-    auto newNode {ForwardList::getNewNode()};
-    new (&newNode->data) valueType(move(value));
-    newNode->next = cursor->next;
-    cursor->next = newNode;
-    return iterator(newNode);
+    return this->insertAfter(constIterator(reinterpret_cast<constNodeType *>(this->seek(index))), move(value));
 }
 template <typename T, typename Allocator>
 typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::insertAfter(
         constIterator position, rightValueReference value
 ) {
-    return this->insertAfter(IteratorDifference<constIterator>()(this->cbegin(), position), move(value));
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto newNode {this->getNewNode()};
+    new (&newNode->data) valueType(move(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, rightValueReference);
+    newNode->next = cursor->next;
+    cursor->next = newNode;
+    ++this->count;
+    return iterator(newNode);
 }
 template <typename T, typename Allocator>
 template <typename InputIterator,
@@ -519,12 +597,7 @@ typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::insertAfter(differenceType index,
         typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
 ) {
-    auto cursor {this->first->next};
-    while(index--) {
-        cursor = cursor->next;
-    }
-    this->setLink(first, last, cursor);
-    return iterator(cursor->next);
+    return this->insertAfter(constIterator(reinterpret_cast<constNodeType *>(this->seek(index))), first, last);
 }
 template <typename T, typename Allocator>
 template <typename InputIterator,
@@ -534,9 +607,9 @@ typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::insertAfter(constIterator position,
         typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
 ) {
-    return this->insertAfter(
-                IteratorDifference<constIterator>()(this->cbegin(), position), first, last
-           );
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    this->setLink(first, last, cursor);
+    return iterator(cursor->next);
 }
 template <typename T, typename Allocator>
 typename DataStructure::ForwardList<T, Allocator>::iterator
@@ -550,44 +623,45 @@ typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::insertAfter(
         constIterator position, std::initializer_list<valueType> list
 ) {
-    return this->insertAfter(
-                IteratorDifference<constIterator>()(this->cbegin(), position), list.begin(), list.end()
-           );
+    return this->insertAfter(position, list.begin(), list.end());
 }
 template <typename T, typename Allocator>
 typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::eraseAfter(differenceType index, sizeType size) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
-    auto cursor {this->first->next};
-    while(index--) {
-        cursor = cursor->next;
-    }
-    auto eraseCursor {cursor->next};
-    while(size--) {
-        auto next {eraseCursor->next};
-        delete eraseCursor;
-        eraseCursor = next;
-    }
-    cursor->next = eraseCursor;
-    return iterator(eraseCursor->next);
+    return this->eraseAfter(constIterator(reinterpret_cast<constNodeType *>(this->seek(index))), size);
 }
 template <typename T, typename Allocator>
 typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::eraseAfter(constIterator position, sizeType size) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
-    return this->eraseAfter(IteratorDifference<constIterator>()(this->cbegin(), position), size);
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto eraseCursor {cursor->next};
+    for(; size-- and eraseCursor; --this->count) {
+        auto next {eraseCursor->next};
+        this->deleteNode(eraseCursor);
+        eraseCursor = next;
+    }
+    cursor->next = eraseCursor;
+    return iterator(eraseCursor);
 }
 template <typename T, typename Allocator>
 typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::eraseAfter(constIterator first, constIterator last) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
-    return this->eraseAfter(
-            IteratorDifference<constIterator>()(this->cbegin(), first),
-            IteratorDifference<constIterator>()(first, last)
-           );
+    auto cursor {reinterpret_cast<node>(first.iterator)};
+    const auto end {reinterpret_cast<node>(last.iterator)};
+    auto eraseCursor {cursor->next};
+    for(; eraseCursor not_eq end; --this->count) {
+        auto next {eraseCursor->next};
+        this->deleteNode(eraseCursor);
+        eraseCursor = next;
+    }
+    cursor->next = end;
+    return iterator(end);
 }
 template <typename T, typename Allocator>
 template <typename ...Args>
@@ -599,9 +673,7 @@ template <typename T, typename Allocator>
 template <typename ...Args>
 typename DataStructure::ForwardList<T, Allocator>::iterator
 DataStructure::ForwardList<T, Allocator>::emplaceAfter(constIterator position, Args &&...args) {
-    return this->insertAfter(IteratorDifference<constIterator>()(this->cbegin, position),
-                valueType(std::forward<Args>(args)...)
-           );
+    return this->insertAfter(position, valueType(std::forward<Args>(args)...));
 }
 template <typename T, typename Allocator>
 template <typename ...Args>
@@ -610,17 +682,21 @@ void DataStructure::ForwardList<T, Allocator>::emplaceFront(Args &&...args) {
 }
 template <typename T, typename Allocator>
 void DataStructure::ForwardList<T, Allocator>::pushFront(constReference value) {
-    auto newNode {ForwardList::getNewNode()};
+    auto newNode {this->getNewNode()};
+    new (&newNode->data) valueType(value);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, constReference);
     newNode->next = this->first->next;
     this->first->next = newNode;
-    new (&newNode->data) valueType(value);
+    ++this->count;
 }
 template <typename T, typename Allocator>
 void DataStructure::ForwardList<T, Allocator>::pushFront(rightValueReference value) {
-    auto newNode {ForwardList::getNewNode()};
+    auto newNode {this->getNewNode()};
+    new (&newNode->data) valueType(move(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(ForwardList, rightValueReference);
     newNode->next = this->first->next;
     this->first->next = newNode;
-    new (&newNode->data) valueType(move(value));
+    ++this->count;
 }
 template <typename T, typename Allocator>
 #ifdef POP_GET_OBJECT
@@ -636,8 +712,8 @@ DataStructure::ForwardList<T, Allocator>::popFront() noexcept(
     auto value {move(popNode->data)};
 #endif
     this->first->next = popNode->next;
-    allocator::destroy(&popNode->data);
-    delete popNode;
+    --this->count;
+    this->deleteNode(popNode);
 #ifdef POP_GET_OBJECT
     return value;
 #endif
@@ -646,6 +722,216 @@ template <typename T, typename Allocator>
 void DataStructure::ForwardList<T, Allocator>::swap(ForwardList &rhs) noexcept {
     using std::swap;
     swap(this->first, rhs.first);
+    swap(this->count, rhs.count);
+    this->slab.swap(rhs.slab);
+}
+template <typename T, typename Allocator>
+inline void DataStructure::ForwardList<T, Allocator>::transferAfter(node position, node before, node last) noexcept {
+    auto first {before->next};
+    before->next = last->next;
+    last->next = position->next;
+    position->next = first;
+}
+template <typename T, typename Allocator>
+typename DataStructure::ForwardList<T, Allocator>::iterator
+DataStructure::ForwardList<T, Allocator>::spliceAfter(constIterator position, ForwardList &rhs) {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    if(&rhs == this or not rhs.first->next) {
+        return iterator(cursor);
+    }
+    this->slab.share(rhs.slab);
+    auto last {rhs.first->next};
+    while(last->next) {
+        last = last->next;
+    }
+    ForwardList::transferAfter(cursor, rhs.first, last);
+    this->count += rhs.count;
+    rhs.count = 0;
+    return iterator(last);
+}
+template <typename T, typename Allocator>
+typename DataStructure::ForwardList<T, Allocator>::iterator
+DataStructure::ForwardList<T, Allocator>::spliceAfter(
+        constIterator position, ForwardList &rhs, constIterator before
+) {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto beforeNode {reinterpret_cast<node>(before.iterator)};
+    auto moved {beforeNode->next};
+    if(cursor == beforeNode or cursor == moved) {
+        return iterator(moved);
+    }
+    this->slab.share(rhs.slab);
+    ForwardList::transferAfter(cursor, beforeNode, moved);
+    ++this->count;
+    --rhs.count;
+    return iterator(moved);
+}
+template <typename T, typename Allocator>
+typename DataStructure::ForwardList<T, Allocator>::iterator
+DataStructure::ForwardList<T, Allocator>::spliceAfter(
+        constIterator position, ForwardList &rhs, constIterator first, constIterator last
+) {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto before {reinterpret_cast<node>(first.iterator)};
+    auto end {reinterpret_cast<node>(last.iterator)};
+    if(before->next == end) {
+        return iterator(cursor);
+    }
+    this->slab.share(rhs.slab);
+    auto tail {before->next};
+    sizeType moved {1};
+    for(; tail->next not_eq end; ++moved) {
+        tail = tail->next;
+    }
+    ForwardList::transferAfter(cursor, before, tail);
+    this->count += moved;
+    rhs.count -= moved;
+    return iterator(tail);
+}
+template <typename T, typename Allocator>
+void DataStructure::ForwardList<T, Allocator>::merge(ForwardList &rhs) {
+    this->merge(rhs, [](constReference lhs, constReference rhs) -> bool {
+        return lhs < rhs;
+    });
+}
+template <typename T, typename Allocator>
+template <typename Compare>
+void DataStructure::ForwardList<T, Allocator>::merge(ForwardList &rhs, Compare compare) {
+    if(&rhs == this or not rhs.first->next) {
+        return;
+    }
+    this->slab.share(rhs.slab);
+    auto cursor {this->first};
+    while(cursor->next and rhs.first->next) {
+        if(not compare(rhs.first->next->data, cursor->next->data)) {
+            cursor = cursor->next;
+            continue;
+        }
+        auto last {rhs.first->next};
+        sizeType moved {1};
+        for(; last->next and compare(last->next->data, cursor->next->data); ++moved) {
+            last = last->next;
+        }
+        ForwardList::transferAfter(cursor, rhs.first, last);
+        this->count += moved;
+        rhs.count -= moved;
+        cursor = last;
+    }
+    if(rhs.first->next) {
+        cursor->next = rhs.first->next;
+        rhs.first->next = nullptr;
+        this->count += rhs.count;
+        rhs.count = 0;
+    }
+}
+template <typename T, typename Allocator>
+void DataStructure::ForwardList<T, Allocator>::sort() {
+    this->sort([](constReference lhs, constReference rhs) -> bool {
+        return lhs < rhs;
+    });
+}
+template <typename T, typename Allocator>
+template <typename Compare>
+void DataStructure::ForwardList<T, Allocator>::sort(Compare compare) {
+    auto chain {this->first->next};
+    if(not chain or not chain->next) {
+        return;
+    }
+    try {
+        __DataStructure_ChainSorter<nodeType>::sort(chain, compare, __DataStructure_falseType());
+    }catch(...) {
+        this->first->next = chain;
+        throw;
+    }
+    this->first->next = chain;
+}
+template <typename T, typename Allocator>
+typename DataStructure::ForwardList<T, Allocator>::sizeType DataStructure::ForwardList<T, Allocator>::unique() {
+    return this->unique([](constReference lhs, constReference rhs) -> bool {
+        return lhs == rhs;
+    });
+}
+template <typename T, typename Allocator>
+template <typename BinaryPredicate>
+typename DataStructure::ForwardList<T, Allocator>::sizeType
+DataStructure::ForwardList<T, Allocator>::unique(BinaryPredicate predicate) {
+    sizeType removed {0};
+    auto cursor {this->first->next};
+    if(not cursor) {
+        return removed;
+    }
+    for(auto next {cursor->next}; next; next = cursor->next) {
+        if(not predicate(cursor->data, next->data)) {
+            cursor = next;
+            continue;
+        }
+        cursor->next = next->next;
+        this->deleteNode(next);
+        ++removed;
+        --this->count;
+    }
+    return removed;
+}
+template <typename T, typename Allocator>
+typename DataStructure::ForwardList<T, Allocator>::sizeType
+DataStructure::ForwardList<T, Allocator>::remove(constReference value) {
+    sizeType removed {0};
+    node deferred {nullptr};
+    auto deferredBefore {this->first};
+    for(auto before {this->first}; before->next;) {
+        auto cursor {before->next};
+        if(not(cursor->data == value)) {
+            before = cursor;
+            continue;
+        }
+        if(&cursor->data == &value) {
+            deferred = cursor;
+            deferredBefore = before;
+            before = cursor;
+            continue;
+        }
+        before->next = cursor->next;
+        this->deleteNode(cursor);
+        ++removed;
+        --this->count;
+    }
+    if(deferred) {
+        deferredBefore->next = deferred->next;
+        this->deleteNode(deferred);
+        ++removed;
+        --this->count;
+    }
+    return removed;
+}
+template <typename T, typename Allocator>
+template <typename UnaryPredicate>
+typename DataStructure::ForwardList<T, Allocator>::sizeType
+DataStructure::ForwardList<T, Allocator>::removeIf(UnaryPredicate predicate) {
+    sizeType removed {0};
+    for(auto before {this->first}; before->next;) {
+        auto cursor {before->next};
+        if(not predicate(cursor->data)) {
+            before = cursor;
+            continue;
+        }
+        before->next = cursor->next;
+        this->deleteNode(cursor);
+        ++removed;
+        --this->count;
+    }
+    return removed;
+}
+template <typename T, typename Allocator>
+void DataStructure::ForwardList<T, Allocator>::reverse() noexcept {
+    node previous {nullptr};
+    auto cursor {this->first->next};
+    while(cursor) {
+        auto next {cursor->next};
+        cursor->next = previous;
+        previous = cursor;
+        cursor = next;
+    }
+    this->first->next = previous;
 }
 
 #ifdef DEBUG_DATA_STRUCTURE_FOR_FORWARD_LIST
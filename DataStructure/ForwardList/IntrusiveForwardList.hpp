@@ -0,0 +1,264 @@
+#ifndef DATA_STRUCTURE_INTRUSIVE_FORWARD_LIST_HPP
+#define DATA_STRUCTURE_INTRUSIVE_FORWARD_LIST_HPP
+
+#include "../Iterator.hpp"
+
+namespace DataStructure {
+    template <typename T, IntrusiveForwardListHook T::*Hook>
+    class IntrusiveForwardList final {
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = T &;
+        using constReference = const T &;
+        using pointer = T *;
+        using constPointer = const T *;
+    private:
+        using nodeType = __DataStructure_IntrusiveForwardNode<valueType, reference, pointer, Hook>;
+        using constNodeType = __DataStructure_IntrusiveForwardNode<valueType, constReference, constPointer, Hook>;
+    public:
+        using iterator = __DataStructure_ForwardListIterator<nodeType>;
+        using constIterator = __DataStructure_ForwardListIterator<constNodeType>;
+    private:
+        using node = nodeType *;
+    private:
+        nodeType first;
+        sizeType count;
+    private:
+        node sentinel() const noexcept;
+        void take(IntrusiveForwardList &) noexcept;
+    public:
+        IntrusiveForwardList() noexcept;
+        IntrusiveForwardList(const IntrusiveForwardList &) = delete;
+        IntrusiveForwardList(IntrusiveForwardList &&) noexcept;
+        ~IntrusiveForwardList();
+    public:
+        IntrusiveForwardList &operator=(const IntrusiveForwardList &) = delete;
+        IntrusiveForwardList &operator=(IntrusiveForwardList &&) noexcept;
+    public:
+        reference front() const noexcept;
+        iterator begin() const noexcept;
+        constIterator cbegin() const noexcept;
+        constexpr iterator end() const noexcept;
+        constexpr constIterator cend() const noexcept;
+        iterator beforeBegin() const noexcept;
+        constIterator beforeCBegin() const noexcept;
+        static iterator iteratorTo(reference) noexcept;
+        static constIterator iteratorTo(constReference) noexcept;
+        bool empty() const noexcept;
+        sizeType size() const noexcept;
+        void clear() noexcept;
+        iterator insertAfter(constIterator, reference) noexcept;
+        iterator eraseAfter(constIterator) noexcept;
+        iterator eraseAfter(constIterator, constIterator) noexcept;
+        void pushFront(reference) noexcept;
+        void popFront() noexcept;
+        iterator spliceAfter(constIterator, IntrusiveForwardList &) noexcept;
+        iterator spliceAfter(constIterator, IntrusiveForwardList &, constIterator) noexcept;
+        void reverse() noexcept;
+        void swap(IntrusiveForwardList &) noexcept;
+    };
+    template <typename T, IntrusiveForwardListHook T::*Hook>
+    void swap(IntrusiveForwardList<T, Hook> &, IntrusiveForwardList<T, Hook> &) noexcept;
+}
+
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+void DataStructure::swap(IntrusiveForwardList<T, Hook> &lhs, IntrusiveForwardList<T, Hook> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+inline typename DataStructure::IntrusiveForwardList<T, Hook>::node
+DataStructure::IntrusiveForwardList<T, Hook>::sentinel() const noexcept {
+    return const_cast<node>(&this->first);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+inline void DataStructure::IntrusiveForwardList<T, Hook>::take(IntrusiveForwardList &rhs) noexcept {
+    this->first.next = rhs.first.next;
+    this->count = rhs.count;
+    rhs.first.next = nullptr;
+    rhs.count = 0;
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+DataStructure::IntrusiveForwardList<T, Hook>::IntrusiveForwardList() noexcept : first {nullptr}, count {0} {}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+DataStructure::IntrusiveForwardList<T, Hook>::IntrusiveForwardList(IntrusiveForwardList &&rhs) noexcept :
+        IntrusiveForwardList() {
+    this->take(rhs);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+DataStructure::IntrusiveForwardList<T, Hook>::~IntrusiveForwardList() {
+    this->clear();
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+DataStructure::IntrusiveForwardList<T, Hook> &
+DataStructure::IntrusiveForwardList<T, Hook>::operator=(IntrusiveForwardList &&rhs) noexcept {
+    if(&rhs == this) {
+        return *this;
+    }
+    this->clear();
+    this->take(rhs);
+    return *this;
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::reference
+DataStructure::IntrusiveForwardList<T, Hook>::front() const noexcept {
+    return nodeType::value(this->first.next);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::begin() const noexcept {
+    return iterator(this->first.next);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::constIterator
+DataStructure::IntrusiveForwardList<T, Hook>::cbegin() const noexcept {
+    return constIterator(reinterpret_cast<constNodeType *>(this->first.next));
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+constexpr typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::end() const noexcept {
+    return iterator();
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+constexpr typename DataStructure::IntrusiveForwardList<T, Hook>::constIterator
+DataStructure::IntrusiveForwardList<T, Hook>::cend() const noexcept {
+    return constIterator();
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::beforeBegin() const noexcept {
+    return iterator(this->sentinel());
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::constIterator
+DataStructure::IntrusiveForwardList<T, Hook>::beforeCBegin() const noexcept {
+    return constIterator(reinterpret_cast<constNodeType *>(this->sentinel()));
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::iteratorTo(reference object) noexcept {
+    return iterator(nodeType::hookOf(object));
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::constIterator
+DataStructure::IntrusiveForwardList<T, Hook>::iteratorTo(constReference object) noexcept {
+    return constIterator(constNodeType::hookOf(object));
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+inline bool DataStructure::IntrusiveForwardList<T, Hook>::empty() const noexcept {
+    return not this->first.next;
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+inline typename DataStructure::IntrusiveForwardList<T, Hook>::sizeType
+DataStructure::IntrusiveForwardList<T, Hook>::size() const noexcept {
+    return this->count;
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+void DataStructure::IntrusiveForwardList<T, Hook>::clear() noexcept {
+    auto cursor {this->first.next};
+    while(cursor) {
+        auto next {cursor->next};
+        cursor->next = nullptr;
+        cursor = next;
+    }
+    this->first.next = nullptr;
+    this->count = 0;
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::insertAfter(constIterator position, reference object) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto element {nodeType::hookOf(object)};
+    element->next = cursor->next;
+    cursor->next = element;
+    ++this->count;
+    return iterator(element);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::eraseAfter(constIterator position) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto element {cursor->next};
+    cursor->next = element->next;
+    element->next = nullptr;
+    --this->count;
+    return iterator(cursor->next);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::eraseAfter(constIterator position, constIterator last) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    const auto end {reinterpret_cast<node>(last.iterator)};
+    while(cursor->next not_eq end) {
+        this->eraseAfter(position);
+    }
+    return iterator(end);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+inline void DataStructure::IntrusiveForwardList<T, Hook>::pushFront(reference object) noexcept {
+    this->insertAfter(this->beforeCBegin(), object);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+inline void DataStructure::IntrusiveForwardList<T, Hook>::popFront() noexcept {
+    this->eraseAfter(this->beforeCBegin());
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::spliceAfter(constIterator position, IntrusiveForwardList &rhs) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    if(&rhs == this or rhs.empty()) {
+        return iterator(cursor);
+    }
+    auto last {rhs.first.next};
+    while(last->next) {
+        last = last->next;
+    }
+    last->next = cursor->next;
+    cursor->next = rhs.first.next;
+    this->count += rhs.count;
+    rhs.first.next = nullptr;
+    rhs.count = 0;
+    return iterator(last);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+typename DataStructure::IntrusiveForwardList<T, Hook>::iterator
+DataStructure::IntrusiveForwardList<T, Hook>::spliceAfter(constIterator position, IntrusiveForwardList &rhs,
+                                                          constIterator before) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto previous {reinterpret_cast<node>(before.iterator)};
+    auto moved {previous->next};
+    if(cursor == previous or cursor == moved) {
+        return iterator(moved);
+    }
+    previous->next = moved->next;
+    moved->next = cursor->next;
+    cursor->next = moved;
+    ++this->count;
+    --rhs.count;
+    return iterator(moved);
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+void DataStructure::IntrusiveForwardList<T, Hook>::reverse() noexcept {
+    node reversed {nullptr};
+    auto cursor {this->first.next};
+    while(cursor) {
+        auto next {cursor->next};
+        cursor->next = reversed;
+        reversed = cursor;
+        cursor = next;
+    }
+    this->first.next = reversed;
+}
+template <typename T, DataStructure::IntrusiveForwardListHook T::*Hook>
+void DataStructure::IntrusiveForwardList<T, Hook>::swap(IntrusiveForwardList &rhs) noexcept {
+    if(&rhs == this) {
+        return;
+    }
+    IntrusiveForwardList temp {move(rhs)};
+    rhs.take(*this);
+    this->take(temp);
+}
+
+#endif //DATA_STRUCTURE_INTRUSIVE_FORWARD_LIST_HPP
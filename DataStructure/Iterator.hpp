@@ -259,9 +259,65 @@ namespace DataStructure {
     public:
         link next;
         valueType data;
+    public:
+        static reference value(link element) noexcept {
+            return element->data;
+        }
+    };
+    /*
+     * The distance from the beginning of an object to its hook. The member pointer is applied to an address aligned
+     * for T, nothing is read from it.
+     */
+    template <typename T, typename Hook>
+    inline long __DataStructure_hookOffset(Hook T::*hook) noexcept {
+        const auto object {reinterpret_cast<T *>(static_cast<unsigned long>(alignof(T)) << 8)};
+        return reinterpret_cast<char *>(&(object->*hook)) - reinterpret_cast<char *>(object);
+    }
+    struct IntrusiveForwardListHook {
+        IntrusiveForwardListHook *next;
+        constexpr IntrusiveForwardListHook() noexcept : next {nullptr} {}
+        constexpr IntrusiveForwardListHook(const IntrusiveForwardListHook &) noexcept : next {nullptr} {}
+        IntrusiveForwardListHook &operator=(const IntrusiveForwardListHook &) noexcept {
+            return *this;
+        }
+    };
+    template <typename T, typename Ref, typename Ptr, IntrusiveForwardListHook T::*Hook>
+    struct __DataStructure_IntrusiveForwardNode final {
+    private:
+        using node = __DataStructure_IntrusiveForwardNode;
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = Ref;
+        using pointer = Ptr;
+        using link = node *;
+        using reverseType = __DataStructure_IntrusiveForwardNode<
+                                valueType,
+                                typename __DataStructure_ConstOrNonConst<Ref>::__result,
+                                typename __DataStructure_ConstOrNonConst<Ptr>::__result,
+                                Hook
+                            >;
+    public:
+        link next;
+    public:
+        static reference value(link element) noexcept {
+            return *reinterpret_cast<pointer>(reinterpret_cast<char *>(element) - __DataStructure_hookOffset(Hook));
+        }
+        static link hookOf(reference object) noexcept {
+            return reinterpret_cast<link>(const_cast<IntrusiveForwardListHook *>(&(object.*Hook)));
+        }
     };
+    template <typename T, typename Alloc>
+    class ForwardList;
+    template <typename T, IntrusiveForwardListHook T::*Hook>
+    class IntrusiveForwardList;
     template <typename NodeType>
     class __DataStructure_ForwardListIterator {
+        template <typename, typename>
+        friend class ForwardList;
+        template <typename T, IntrusiveForwardListHook T::*>
+        friend class IntrusiveForwardList;
     private:
         using nodeType = NodeType;
         using thisType = __DataStructure_ForwardListIterator;
@@ -288,7 +344,7 @@ namespace DataStructure {
         __DataStructure_ForwardListIterator &operator=(const thisType &) = default;
         __DataStructure_ForwardListIterator &operator=(thisType &&) noexcept = default;
         reference operator*() const noexcept {
-            return this->iterator->data;
+            return nodeType::value(this->iterator);
         }
         pointer operator->() const noexcept {
             return &**this;
@@ -363,9 +419,61 @@ namespace DataStructure {
         link next;
         link previous;
         valueType data;
+    public:
+        static reference value(link element) noexcept {
+            return element->data;
+        }
     };
+    struct IntrusiveListHook {
+        IntrusiveListHook *next;
+        IntrusiveListHook *previous;
+        constexpr IntrusiveListHook() noexcept : next {nullptr}, previous {nullptr} {}
+        constexpr IntrusiveListHook(const IntrusiveListHook &) noexcept : next {nullptr}, previous {nullptr} {}
+        IntrusiveListHook &operator=(const IntrusiveListHook &) noexcept {
+            return *this;
+        }
+        bool isLinked() const noexcept {
+            return this->next;
+        }
+    };
+    template <typename T, typename Ref, typename Ptr, IntrusiveListHook T::*Hook>
+    struct __DataStructure_IntrusiveBidirectionalNode final {
+    private:
+        using node = __DataStructure_IntrusiveBidirectionalNode;
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = Ref;
+        using pointer = Ptr;
+        using link = node *;
+        using reverseType = __DataStructure_IntrusiveBidirectionalNode<
+                                valueType,
+                                typename __DataStructure_ConstOrNonConst<Ref>::__result,
+                                typename __DataStructure_ConstOrNonConst<Ptr>::__result,
+                                Hook
+                            >;
+    public:
+        link next;
+        link previous;
+    public:
+        static reference value(link element) noexcept {
+            return *reinterpret_cast<pointer>(reinterpret_cast<char *>(element) - __DataStructure_hookOffset(Hook));
+        }
+        static link hookOf(reference object) noexcept {
+            return reinterpret_cast<link>(const_cast<IntrusiveListHook *>(&(object.*Hook)));
+        }
+    };
+    template <typename T, typename Alloc>
+    class List;
+    template <typename T, IntrusiveListHook T::*Hook>
+    class IntrusiveList;
     template <typename NodeType>
     class __DataStructure_ListIterator {
+        template <typename, typename>
+        friend class List;
+        template <typename T, IntrusiveListHook T::*>
+        friend class IntrusiveList;
     private:
         using nodeType = NodeType;
         using thisType = __DataStructure_ListIterator;
@@ -392,7 +500,7 @@ namespace DataStructure {
         __DataStructure_ListIterator &operator=(const thisType &) = default;
         __DataStructure_ListIterator &operator=(thisType &&) noexcept = default;
         reference operator*() const noexcept {
-            return this->iterator->data;
+            return nodeType::value(this->iterator);
         }
         pointer operator->() const noexcept {
             return &**this;
@@ -462,7 +570,7 @@ namespace DataStructure {
         __DataStructure_ListReverseIterator &operator=(const thisType &) = default;
         __DataStructure_ListReverseIterator &operator=(thisType &&) noexcept = default;
         reference operator*() const noexcept {
-            return this->iterator->data;
+            return nodeType::value(this->iterator);
         }
         pointer operator->() const noexcept {
             return &**this;
@@ -499,12 +607,306 @@ namespace DataStructure {
             return static_cast<bool>(this->iterator);
         }
     };
-    template <typename T, typename Ref, typename Ptr, typename Allocator>
+    /*
+     * Sorts a null-terminated chain of nodes linked by next. If the tag is true, the previous links are kept while
+     * merging and the head of every chain holds the tail of the chain as its previous.
+     */
+    template <typename NodeType>
+    struct __DataStructure_ChainSorter final {
+        using link = NodeType *;
+        static void single(link, __DataStructure_falseType) noexcept {}
+        static void single(link node, __DataStructure_trueType) noexcept {
+            node->previous = node;
+        }
+        static link tailOf(link, __DataStructure_falseType) noexcept {
+            return nullptr;
+        }
+        static link tailOf(link head, __DataStructure_trueType) noexcept {
+            return head->previous;
+        }
+        static void append(link &, link, __DataStructure_falseType) noexcept {}
+        static void append(link &last, link node, __DataStructure_trueType) noexcept {
+            node->previous = last;
+            last = node;
+        }
+        static void finish(link, link, link, link, __DataStructure_falseType) noexcept {}
+        static void finish(link head, link last, link rest, link restTail, __DataStructure_trueType) noexcept {
+            rest->previous = last;
+            head->previous = restTail;
+        }
+        template <typename Compare, typename IsBidirectional>
+        static void merge(link earlier, link &later, Compare &compare, IsBidirectional isBidirectional) {
+            link head {nullptr}, last {nullptr};
+            auto tail {&head};
+            const auto earlierTail {tailOf(earlier, isBidirectional)}, laterTail {tailOf(later, isBidirectional)};
+            try {
+                while(earlier and later) {
+                    if(compare(NodeType::value(later), NodeType::value(earlier))) {
+                        *tail = later;
+                        later = later->next;
+                    }else {
+                        *tail = earlier;
+                        earlier = earlier->next;
+                    }
+                    append(last, *tail, isBidirectional);
+                    tail = &(*tail)->next;
+                }
+            }catch(...) {
+                for(*tail = earlier; *tail; tail = &(*tail)->next);
+                *tail = later;
+                later = head;
+                throw;
+            }
+            *tail = earlier ? earlier : later;
+            finish(head, last, *tail, earlier ? earlierTail : laterTail, isBidirectional);
+            later = head;
+        }
+        template <typename Compare, typename IsBidirectional>
+        static void sort(link &chain, Compare &compare, IsBidirectional isBidirectional) {
+            link bucket[sizeof(unsigned long) * 8] {};
+            link carry {nullptr};
+            try {
+                while(chain) {
+                    carry = chain;
+                    chain = chain->next;
+                    carry->next = nullptr;
+                    single(carry, isBidirectional);
+                    auto i {0};
+                    for(; bucket[i]; ++i) {
+                        auto earlier {bucket[i]};
+                        bucket[i] = nullptr;
+                        merge(earlier, carry, compare, isBidirectional);
+                    }
+                    bucket[i] = carry;
+                    carry = nullptr;
+                }
+                for(auto &sorted : bucket) {
+                    if(not sorted) {
+                        continue;
+                    }
+                    auto earlier {sorted};
+                    sorted = nullptr;
+                    if(carry) {
+                        merge(earlier, carry, compare, isBidirectional);
+                    }else {
+                        carry = earlier;
+                    }
+                }
+            }catch(...) {
+                auto tail {&chain};
+                for(; *tail; tail = &(*tail)->next);
+                *tail = carry;
+                for(auto &sorted : bucket) {
+                    for(; *tail; tail = &(*tail)->next);
+                    *tail = sorted;
+                }
+                throw;
+            }
+            chain = carry;
+        }
+    };
+    template <typename T, typename Ref, typename Ptr, unsigned long Capacity>
+    struct __DataStructure_UnrolledListNode final {
+        static_assert(Capacity > 0, "The capacity of the node should be greater than 0!");
+    private:
+        using node = __DataStructure_UnrolledListNode;
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = Ref;
+        using pointer = Ptr;
+        using link = node *;
+        using reverseType = __DataStructure_UnrolledListNode<
+                                valueType,
+                                typename __DataStructure_ConstOrNonConst<Ref>::__result,
+                                typename __DataStructure_ConstOrNonConst<Ptr>::__result,
+                                Capacity
+                            >;
+    public:
+        link next;
+        link previous;
+        sizeType size;
+        alignas(valueType) unsigned char storage[sizeof(valueType) * Capacity];
+    public:
+        pointer begin() noexcept {
+            return reinterpret_cast<pointer>(this->storage);
+        }
+        pointer end() noexcept {
+            return this->begin() + static_cast<differenceType>(this->size);
+        }
+    };
+    template <typename T, unsigned long NodeCapacity, typename Alloc>
+    class UnrolledList;
+    template <typename NodeType>
+    class __DataStructure_UnrolledListIterator {
+        template <typename, unsigned long, typename>
+        friend class UnrolledList;
+    private:
+        using nodeType = NodeType;
+        using thisType = __DataStructure_UnrolledListIterator;
+    public:
+        using sizeType = typename nodeType::sizeType;
+        using differenceType = typename nodeType::differenceType;
+        using valueType = typename nodeType::valueType;
+        using reference = typename nodeType::reference;
+        using constReference = const valueType &;
+        using rightValueReference = valueType &&;
+        using pointer = typename nodeType::pointer;
+        using constPointer = const valueType *;
+        using iteratorTag = BidirectionalIterator;
+        using link = typename nodeType::link;
+    private:
+        pointer iterator;
+        link node;
+    public:
+        constexpr __DataStructure_UnrolledListIterator() : iterator {nullptr}, node {nullptr} {}
+        __DataStructure_UnrolledListIterator(pointer iterator, link node) : iterator {iterator}, node {node} {}
+        __DataStructure_UnrolledListIterator(const thisType &) = default;
+        __DataStructure_UnrolledListIterator(thisType &&) noexcept = default;
+        ~__DataStructure_UnrolledListIterator() = default;
+    public:
+        __DataStructure_UnrolledListIterator &operator=(const thisType &) = default;
+        __DataStructure_UnrolledListIterator &operator=(thisType &&) noexcept = default;
+        reference operator*() const noexcept {
+            return *this->iterator;
+        }
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+        thisType &operator++() noexcept {
+            if(++this->iterator == this->node->end()) {
+                this->node = this->node->next;
+                this->iterator = this->node->begin();
+            }
+            return *this;
+        }
+        thisType operator++(int) noexcept {
+            auto temp {*this};
+            ++*this;
+            return temp;
+        }
+        /*
+         * The head node of the list is the only node without any element,
+         * stepping back into it from the first element gives the end iterator.
+         */
+        thisType &operator--() noexcept {
+            if(this->iterator == this->node->begin()) {
+                this->node = this->node->previous;
+                this->iterator = this->node->end();
+                if(not this->node->size) {
+                    return *this;
+                }
+            }
+            --this->iterator;
+            return *this;
+        }
+        thisType operator--(int) noexcept {
+            auto temp {*this};
+            --*this;
+            return temp;
+        }
+        bool operator==(const thisType &rhs) const noexcept {
+            return this->iterator == rhs.iterator;
+        }
+        bool operator!=(const thisType &rhs) const noexcept {
+            return not(*this == rhs);
+        }
+        bool operator<(const thisType &) const noexcept = delete;
+        bool operator<=(const thisType &) const noexcept = delete;
+        bool operator>(const thisType &) const noexcept = delete;
+        bool operator>=(const thisType &) const noexcept = delete;
+        explicit operator bool() const noexcept {
+            return static_cast<bool>(this->iterator);
+        }
+        operator __DataStructure_UnrolledListIterator<typename nodeType::reverseType>() const noexcept {
+            return __DataStructure_UnrolledListIterator<typename nodeType::reverseType>(
+                    static_cast<typename nodeType::reverseType::pointer>(
+                            const_cast<typename RemoveConst<valueType>::type *>(this->iterator)
+                    ),
+                    reinterpret_cast<typename nodeType::reverseType *>(this->node)
+            );
+        }
+    };
+    template <typename NodeType>
+    class __DataStructure_UnrolledListReverseIterator final {
+        template <typename, unsigned long, typename>
+        friend class UnrolledList;
+    private:
+        using nodeType = NodeType;
+        using thisType = __DataStructure_UnrolledListReverseIterator;
+        using iteratorType = __DataStructure_UnrolledListIterator<nodeType>;
+    public:
+        using sizeType = typename nodeType::sizeType;
+        using differenceType = typename nodeType::differenceType;
+        using valueType = typename nodeType::valueType;
+        using reference = typename nodeType::reference;
+        using constReference = const valueType &;
+        using rightValueReference = valueType &&;
+        using pointer = typename nodeType::pointer;
+        using constPointer = const valueType *;
+        using iteratorTag = BidirectionalIterator;
+        using link = typename nodeType::link;
+    private:
+        iteratorType iterator;
+    public:
+        constexpr __DataStructure_UnrolledListReverseIterator() : iterator() {}
+        explicit __DataStructure_UnrolledListReverseIterator(iteratorType iterator) : iterator {iterator} {}
+        __DataStructure_UnrolledListReverseIterator(const thisType &) = default;
+        __DataStructure_UnrolledListReverseIterator(thisType &&) noexcept = default;
+        ~__DataStructure_UnrolledListReverseIterator() = default;
+    public:
+        __DataStructure_UnrolledListReverseIterator &operator=(const thisType &) = default;
+        __DataStructure_UnrolledListReverseIterator &operator=(thisType &&) noexcept = default;
+        reference operator*() const noexcept {
+            return *this->iterator;
+        }
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+        thisType &operator++() noexcept {
+            --this->iterator;
+            return *this;
+        }
+        thisType operator++(int) noexcept {
+            auto temp {*this};
+            ++*this;
+            return temp;
+        }
+        thisType &operator--() noexcept {
+            ++this->iterator;
+            return *this;
+        }
+        thisType operator--(int) noexcept {
+            auto temp {*this};
+            --*this;
+            return temp;
+        }
+        bool operator==(const thisType &rhs) const noexcept {
+            return this->iterator == rhs.iterator;
+        }
+        bool operator!=(const thisType &rhs) const noexcept {
+            return not(*this == rhs);
+        }
+        bool operator<(const thisType &) const noexcept = delete;
+        bool operator<=(const thisType &) const noexcept = delete;
+        bool operator>(const thisType &) const noexcept = delete;
+        bool operator>=(const thisType &) const noexcept = delete;
+        explicit operator bool() const noexcept {
+            return static_cast<bool>(this->iterator);
+        }
+    };
+    template <typename T, typename Alloc, unsigned long BufferSize>
+    class Deque;
+    template <typename T, typename Ref, typename Ptr, unsigned long BufferSize>
     class __DataStructure_DequeIterator final {
+        static_assert(BufferSize not_eq 0 and (BufferSize & (BufferSize - 1)) == 0,
+                "The size of buffer must be a power of two!"
+        );
+        template <typename, typename, unsigned long>
+        friend class Deque;
     private:
         using thisType = __DataStructure_DequeIterator;
-        using allocatorType = Allocator;
-        using buffer = allocatorType *;
     public:
         using sizeType = unsigned long;
         using differenceType = long;
@@ -515,12 +917,30 @@ namespace DataStructure {
         using pointer = Ptr;
         using constPointer = const valueType *;
         using iteratorTag = RandomAccessIterator;
+        using map = valueType **;
+    private:
+        constexpr static sizeType bufferShift(sizeType size = BufferSize) noexcept {
+            return size == 1 ? 0 : bufferShift(size >> 1) + 1;
+        }
+    private:
+        enum : differenceType {
+            bufferSize = static_cast<differenceType>(BufferSize),
+            shift = static_cast<differenceType>(bufferShift()),
+            mask = static_cast<differenceType>(BufferSize - 1)
+        };
     private:
-        buffer node;
         pointer iterator;
+        pointer first;
+        map node;
+    private:
+        void setNode(map newNode) noexcept {
+            this->node = newNode;
+            this->first = *newNode;
+        }
     public:
-        constexpr __DataStructure_DequeIterator() : node {nullptr}, iterator {nullptr} {}
-        __DataStructure_DequeIterator(pointer iterator, buffer node) : node {node}, iterator {iterator} {}
+        constexpr __DataStructure_DequeIterator() : iterator {nullptr}, first {nullptr}, node {nullptr} {}
+        __DataStructure_DequeIterator(pointer iterator, pointer first, map node) :
+                iterator {iterator}, first {first}, node {node} {}
         __DataStructure_DequeIterator(const thisType &) = default;
         __DataStructure_DequeIterator(thisType &&) noexcept = default;
         ~__DataStructure_DequeIterator() = default;
@@ -534,15 +954,13 @@ namespace DataStructure {
             return &**this;
         }
         differenceType operator-(const thisType &rhs) const noexcept {
-            return static_cast<differenceType>(this->node->capacity()) * (this->node - rhs.node - 1) +
-                    this->iterator - this->node->begin() + rhs.node->end() - rhs.iterator;
+            return ((this->node - rhs.node) << shift) + (this->iterator - this->first) - (rhs.iterator - rhs.first);
         }
         thisType &operator++() noexcept {
-            if(++this->iterator < this->node->end()) {
-                return *this;
+            if(++this->iterator == this->first + bufferSize) {
+                this->setNode(this->node + 1);
+                this->iterator = this->first;
             }
-            ++this->node;
-            this->iterator = this->node->begin();
             return *this;
         }
         thisType operator++(int) noexcept {
@@ -551,11 +969,11 @@ namespace DataStructure {
             return temp;
         }
         thisType &operator--() noexcept {
-            if(--this->iterator >= this->node->begin()) {
-                return *this;
+            if(this->iterator == this->first) {
+                this->setNode(this->node - 1);
+                this->iterator = this->first + bufferSize;
             }
-            --this->node;
-            this->iterator = this->node->end() - static_cast<differenceType>(1);
+            --this->iterator;
             return *this;
         }
         thisType operator--(int) noexcept {
@@ -564,15 +982,14 @@ namespace DataStructure {
             return temp;
         }
         thisType &operator+=(differenceType n) noexcept {
-            const auto offset {n + (this->iterator - this->node->begin())};
-            const auto size {static_cast<differenceType>(this->node->capacity())};
-            if(offset >= 0 and offset < size) {
+            const auto offset {n + (this->iterator - this->first)};
+            if(offset >= 0 and offset < bufferSize) {
                 this->iterator += n;
                 return *this;
             }
-            const auto nodeOffset {offset > 0 ? offset / size : -((-offset - 1) / size) - 1};
-            this->node += nodeOffset;
-            this->iterator = this->node->begin() + (offset - nodeOffset * size);
+            const auto nodeOffset {offset > 0 ? offset >> shift : -((-offset - 1) >> shift) - 1};
+            this->setNode(this->node + nodeOffset);
+            this->iterator = this->first + (offset & mask);
             return *this;
         }
         thisType &operator-=(differenceType n) noexcept {
@@ -589,7 +1006,7 @@ namespace DataStructure {
             return *(*this + n);
         }
         bool operator==(const thisType &rhs) const noexcept {
-            return this->iterator == rhs.iterator and this->node == rhs.node;
+            return this->iterator == rhs.iterator;
         }
         bool operator!=(const thisType &rhs) const noexcept {
             return not(*this == rhs);
@@ -611,39 +1028,12 @@ namespace DataStructure {
         }
         operator __DataStructure_DequeIterator<valueType,
                     typename __DataStructure_ConstOrNonConst<reference>::__result,
-                    typename __DataStructure_ConstOrNonConst<pointer>::__result, allocatorType
+                    typename __DataStructure_ConstOrNonConst<pointer>::__result, BufferSize
                  >() const noexcept {
+            using reversePointer = typename __DataStructure_ConstOrNonConst<pointer>::__result;
             return __DataStructure_DequeIterator<valueType,
-                        typename __DataStructure_ConstOrNonConst<reference>::__result,
-                        typename __DataStructure_ConstOrNonConst<pointer>::__result, allocatorType
-                   >(reinterpret_cast<
-                           typename __DataStructure_ConstOrNonConst<pointer>::__result
-                     >(this->iterator), this->node);
-        }
-    public:
-        thisType &construct(constReference value) noexcept(static_cast<bool>(
-                typename __DataStructure_TypeTraits<valueType>::hasTrivialCopyConstructor())
-        ) {
-            this->node->construct(this->iterator, value);
-            return *this;
-        }
-        thisType &construct(rightValueReference value) noexcept(static_cast<bool>(
-                typename __DataStructure_TypeTraits<valueType>::hasTrivialMoveConstructor())
-        ) {
-            this->node->construct(this->iterator, value);
-            return *this;
-        }
-        template <typename ...Args>
-        thisType &construct(Args &&...args) noexcept(static_cast<bool>(
-                typename __DataStructure_TypeTraits<valueType>::hasTrivialMoveConstructor())
-        ) {
-            return this->construct(valueType(forward<Args>(args)...));
-        }
-        thisType &destroy() noexcept(static_cast<bool>(
-                typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
-        ) {
-            this->node->destroy(this->iterator);
-            return *this;
+                        typename __DataStructure_ConstOrNonConst<reference>::__result, reversePointer, BufferSize
+                   >(const_cast<reversePointer>(this->iterator), const_cast<reversePointer>(this->first), this->node);
         }
     };
 }
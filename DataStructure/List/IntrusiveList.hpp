@@ -0,0 +1,337 @@
+#ifndef DATA_STRUCTURE_INTRUSIVE_LIST_HPP
+#define DATA_STRUCTURE_INTRUSIVE_LIST_HPP
+
+#include "../Iterator.hpp"
+
+namespace DataStructure {
+    template <typename T, IntrusiveListHook T::*Hook>
+    class IntrusiveList final {
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = T &;
+        using constReference = const T &;
+        using pointer = T *;
+        using constPointer = const T *;
+    private:
+        using nodeType = __DataStructure_IntrusiveBidirectionalNode<valueType, reference, pointer, Hook>;
+        using constNodeType = __DataStructure_IntrusiveBidirectionalNode<
+                valueType, constReference, constPointer, Hook
+        >;
+    public:
+        using iterator = __DataStructure_ListIterator<nodeType>;
+        using constIterator = __DataStructure_ListIterator<constNodeType>;
+        using reverseIterator = __DataStructure_ListReverseIterator<nodeType>;
+        using constReverseIterator = __DataStructure_ListReverseIterator<constNodeType>;
+    private:
+        using node = nodeType *;
+    private:
+        nodeType first;
+        sizeType count;
+    private:
+        node sentinel() const noexcept;
+        void resetFirst() noexcept;
+        void take(IntrusiveList &) noexcept;
+        static void detach(node) noexcept;
+        static void transfer(node, node, node) noexcept;
+    public:
+        IntrusiveList() noexcept;
+        IntrusiveList(const IntrusiveList &) = delete;
+        IntrusiveList(IntrusiveList &&) noexcept;
+        ~IntrusiveList();
+    public:
+        IntrusiveList &operator=(const IntrusiveList &) = delete;
+        IntrusiveList &operator=(IntrusiveList &&) noexcept;
+    public:
+        reference front() const noexcept;
+        reference back() const noexcept;
+        iterator begin() const noexcept;
+        constIterator cbegin() const noexcept;
+        reverseIterator rbegin() const noexcept;
+        constReverseIterator crbegin() const noexcept;
+        iterator end() const noexcept;
+        constIterator cend() const noexcept;
+        reverseIterator rend() const noexcept;
+        constReverseIterator crend() const noexcept;
+        static iterator iteratorTo(reference) noexcept;
+        static constIterator iteratorTo(constReference) noexcept;
+        bool empty() const noexcept;
+        sizeType size() const noexcept;
+        void clear() noexcept;
+        iterator insert(constIterator, reference) noexcept;
+        iterator erase(constIterator) noexcept;
+        iterator erase(constIterator, constIterator) noexcept;
+        void pushBack(reference) noexcept;
+        void pushFront(reference) noexcept;
+        void popFront() noexcept;
+        void popBack() noexcept;
+        iterator splice(constIterator, IntrusiveList &) noexcept;
+        iterator splice(constIterator, IntrusiveList &, constIterator) noexcept;
+        iterator splice(constIterator, IntrusiveList &, constIterator, constIterator) noexcept;
+        void reverse() noexcept;
+        void swap(IntrusiveList &) noexcept;
+    };
+    template <typename T, IntrusiveListHook T::*Hook>
+    void swap(IntrusiveList<T, Hook> &, IntrusiveList<T, Hook> &) noexcept;
+}
+
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+void DataStructure::swap(IntrusiveList<T, Hook> &lhs, IntrusiveList<T, Hook> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline typename DataStructure::IntrusiveList<T, Hook>::node
+DataStructure::IntrusiveList<T, Hook>::sentinel() const noexcept {
+    return const_cast<node>(&this->first);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline void DataStructure::IntrusiveList<T, Hook>::resetFirst() noexcept {
+    this->first.next = this->sentinel();
+    this->first.previous = this->sentinel();
+    this->count = 0;
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline void DataStructure::IntrusiveList<T, Hook>::take(IntrusiveList &rhs) noexcept {
+    if(rhs.empty()) {
+        return;
+    }
+    this->first.next = rhs.first.next;
+    this->first.previous = rhs.first.previous;
+    this->first.next->previous = this->sentinel();
+    this->first.previous->next = this->sentinel();
+    this->count = rhs.count;
+    rhs.resetFirst();
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline void DataStructure::IntrusiveList<T, Hook>::detach(node element) noexcept {
+    element->previous->next = element->next;
+    element->next->previous = element->previous;
+    element->next = nullptr;
+    element->previous = nullptr;
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline void DataStructure::IntrusiveList<T, Hook>::transfer(node position, node first, node last) noexcept {
+    auto tail {last->previous};
+    first->previous->next = last;
+    last->previous = first->previous;
+    first->previous = position->previous;
+    position->previous->next = first;
+    tail->next = position;
+    position->previous = tail;
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+DataStructure::IntrusiveList<T, Hook>::IntrusiveList() noexcept : first {}, count {0} {
+    this->resetFirst();
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+DataStructure::IntrusiveList<T, Hook>::IntrusiveList(IntrusiveList &&rhs) noexcept : IntrusiveList() {
+    this->take(rhs);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+DataStructure::IntrusiveList<T, Hook>::~IntrusiveList() {
+    this->clear();
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+DataStructure::IntrusiveList<T, Hook> &DataStructure::IntrusiveList<T, Hook>::operator=(IntrusiveList &&rhs) noexcept {
+    if(&rhs == this) {
+        return *this;
+    }
+    this->clear();
+    this->take(rhs);
+    return *this;
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::reference
+DataStructure::IntrusiveList<T, Hook>::front() const noexcept {
+    return nodeType::value(this->first.next);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::reference
+DataStructure::IntrusiveList<T, Hook>::back() const noexcept {
+    return nodeType::value(this->first.previous);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::begin() const noexcept {
+    return iterator(this->first.next);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::constIterator
+DataStructure::IntrusiveList<T, Hook>::cbegin() const noexcept {
+    return constIterator(reinterpret_cast<constNodeType *>(this->first.next));
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::reverseIterator
+DataStructure::IntrusiveList<T, Hook>::rbegin() const noexcept {
+    return reverseIterator(this->first.previous);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::constReverseIterator
+DataStructure::IntrusiveList<T, Hook>::crbegin() const noexcept {
+    return constReverseIterator(reinterpret_cast<constNodeType *>(this->first.previous));
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::end() const noexcept {
+    return iterator(this->sentinel());
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::constIterator
+DataStructure::IntrusiveList<T, Hook>::cend() const noexcept {
+    return constIterator(reinterpret_cast<constNodeType *>(this->sentinel()));
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::reverseIterator
+DataStructure::IntrusiveList<T, Hook>::rend() const noexcept {
+    return reverseIterator(this->sentinel());
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::constReverseIterator
+DataStructure::IntrusiveList<T, Hook>::crend() const noexcept {
+    return constReverseIterator(reinterpret_cast<constNodeType *>(this->sentinel()));
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::iteratorTo(reference object) noexcept {
+    return iterator(nodeType::hookOf(object));
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::constIterator
+DataStructure::IntrusiveList<T, Hook>::iteratorTo(constReference object) noexcept {
+    return constIterator(constNodeType::hookOf(object));
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline bool DataStructure::IntrusiveList<T, Hook>::empty() const noexcept {
+    return this->count == 0;
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline typename DataStructure::IntrusiveList<T, Hook>::sizeType
+DataStructure::IntrusiveList<T, Hook>::size() const noexcept {
+    return this->count;
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+void DataStructure::IntrusiveList<T, Hook>::clear() noexcept {
+    auto cursor {this->first.next};
+    while(cursor not_eq this->sentinel()) {
+        auto next {cursor->next};
+        cursor->next = nullptr;
+        cursor->previous = nullptr;
+        cursor = next;
+    }
+    this->resetFirst();
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::insert(constIterator position, reference object) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto element {nodeType::hookOf(object)};
+    element->next = cursor;
+    element->previous = cursor->previous;
+    cursor->previous->next = element;
+    cursor->previous = element;
+    ++this->count;
+    return iterator(element);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::erase(constIterator position) noexcept {
+    auto element {reinterpret_cast<node>(position.iterator)};
+    auto next {element->next};
+    IntrusiveList::detach(element);
+    --this->count;
+    return iterator(next);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::erase(constIterator first, constIterator last) noexcept {
+    while(first not_eq last) {
+        first = this->erase(first);
+    }
+    return iterator(reinterpret_cast<node>(last.iterator));
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline void DataStructure::IntrusiveList<T, Hook>::pushBack(reference object) noexcept {
+    this->insert(this->cend(), object);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline void DataStructure::IntrusiveList<T, Hook>::pushFront(reference object) noexcept {
+    this->insert(this->cbegin(), object);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline void DataStructure::IntrusiveList<T, Hook>::popFront() noexcept {
+    IntrusiveList::detach(this->first.next);
+    --this->count;
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+inline void DataStructure::IntrusiveList<T, Hook>::popBack() noexcept {
+    IntrusiveList::detach(this->first.previous);
+    --this->count;
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::splice(constIterator position, IntrusiveList &rhs) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    if(&rhs == this or rhs.empty()) {
+        return iterator(cursor);
+    }
+    auto first {rhs.first.next};
+    IntrusiveList::transfer(cursor, first, rhs.sentinel());
+    this->count += rhs.count;
+    rhs.count = 0;
+    return iterator(first);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::splice(constIterator position, IntrusiveList &rhs,
+                                              constIterator element) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto moved {reinterpret_cast<node>(element.iterator)};
+    if(cursor == moved or cursor == moved->next) {
+        return iterator(moved);
+    }
+    IntrusiveList::transfer(cursor, moved, moved->next);
+    ++this->count;
+    --rhs.count;
+    return iterator(moved);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+typename DataStructure::IntrusiveList<T, Hook>::iterator
+DataStructure::IntrusiveList<T, Hook>::splice(constIterator position, IntrusiveList &rhs,
+                                              constIterator first, constIterator last) noexcept {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    if(first == last) {
+        return iterator(cursor);
+    }
+    if(&rhs not_eq this) {
+        sizeType moved {0};
+        for(auto it {first}; it not_eq last; ++it, ++moved);
+        this->count += moved;
+        rhs.count -= moved;
+    }
+    auto moved {reinterpret_cast<node>(first.iterator)};
+    IntrusiveList::transfer(cursor, moved, reinterpret_cast<node>(last.iterator));
+    return iterator(moved);
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+void DataStructure::IntrusiveList<T, Hook>::reverse() noexcept {
+    auto cursor {this->sentinel()};
+    do {
+        auto next {cursor->next};
+        cursor->next = cursor->previous;
+        cursor->previous = next;
+        cursor = next;
+    }while(cursor not_eq this->sentinel());
+}
+template <typename T, DataStructure::IntrusiveListHook T::*Hook>
+void DataStructure::IntrusiveList<T, Hook>::swap(IntrusiveList &rhs) noexcept {
+    if(&rhs == this) {
+        return;
+    }
+    IntrusiveList temp {move(rhs)};
+    rhs.take(*this);
+    this->take(temp);
+}
+
+#endif //DATA_STRUCTURE_INTRUSIVE_LIST_HPP
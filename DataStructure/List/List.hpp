@@ -29,8 +29,17 @@ namespace DataStructure {
         using node = nodeType *;
     private:
         node first;
+        sizeType count;
+        __DataStructure_NodeSlab<nodeType, allocator, List> slab;
     private:
-        static node getNewNode();
+        static node getNewFirst();
+        static void deleteFirst(node) noexcept;
+        node getNewNode();
+        void deleteNode(node) noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
     private:
         void free() noexcept(
                     static_cast<bool>(
@@ -45,6 +54,9 @@ namespace DataStructure {
                             InputIterator, node
                      );
         void resetFirst() noexcept;
+        node seek(differenceType) const noexcept;
+        void relink(node) noexcept;
+        static void transfer(node, node, node) noexcept;
     public:
         List();
         explicit List(sizeType);
@@ -155,6 +167,22 @@ namespace DataStructure {
         void emplaceBack(Args &&...);
         template <typename ...Args>
         void emplaceFront(Args &&...);
+        iterator splice(constIterator, List &);
+        iterator splice(constIterator, List &, constIterator);
+        iterator splice(constIterator, List &, constIterator, constIterator);
+        void merge(List &);
+        template <typename Compare>
+        void merge(List &, Compare);
+        void sort();
+        template <typename Compare>
+        void sort(Compare);
+        sizeType unique();
+        template <typename BinaryPredicate>
+        sizeType unique(BinaryPredicate);
+        sizeType remove(constReference);
+        template <typename UnaryPredicate>
+        sizeType removeIf(UnaryPredicate);
+        void reverse() noexcept;
         void swap(List &) noexcept;
 #ifdef DEBUG_DATA_STRUCTURE_FOR_LIST
         node &getFirst() noexcept;
@@ -170,10 +198,28 @@ void DataStructure::swap(List<T, Allocator> &lhs, List<T, Allocator> &rhs) noexc
 }
 
 template <typename T, typename Allocator>
-inline typename DataStructure::List<T, Allocator>::node DataStructure::List<T, Allocator>::getNewNode() {
+inline typename DataStructure::List<T, Allocator>::node
+DataStructure::List<T, Allocator>::getNewFirst() {
+    __DATA_STRUCTURE_STATISTICS_COUNT(List, ALLOCATE);
     return reinterpret_cast<node>(allocator::operator new (sizeof(nodeType)));
 }
 template <typename T, typename Allocator>
+inline typename DataStructure::List<T, Allocator>::node DataStructure::List<T, Allocator>::getNewNode() {
+    return this->slab.allocate();
+}
+template <typename T, typename Allocator>
+inline void DataStructure::List<T, Allocator>::deleteNode(node p) noexcept(
+        static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+) {
+    allocator::destroy(static_cast<void *>(&p->data));
+    __DATA_STRUCTURE_STATISTICS_COUNT(List, DESTROY);
+    this->slab.deallocate(p);
+}
+template <typename T, typename Allocator>
+inline void DataStructure::List<T, Allocator>::deleteFirst(node p) noexcept {
+    allocator::operator delete (p, sizeof(nodeType));
+}
+template <typename T, typename Allocator>
 inline void DataStructure::List<T, Allocator>::free() noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
@@ -184,34 +230,38 @@ inline void DataStructure::List<T, Allocator>::free() noexcept(
     while(cursor not_eq this->first) {
         auto temp {cursor};
         cursor = cursor->next;
-        delete temp;
+        this->deleteNode(temp);
     }
 }
 template <typename T, typename Allocator>
 inline void DataStructure::List<T, Allocator>::setLink(sizeType size, constReference value, node first) {
-    auto newNode {List::getNewNode()};
+    const auto inserted {size};
+    auto newNode {this->getNewNode()};
     newNode->previous = first;
     const auto backup {newNode};
     while(--size) {
         try {
             new (&newNode->data) valueType(value);
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, constReference);
         }catch(...) {
-            while(backup not_eq newNode) {
-                auto next {backup->next};
-                delete backup;
-                backup = next;
+            for(auto cursor {backup}; cursor not_eq newNode;) {
+                auto next {cursor->next};
+                this->deleteNode(cursor);
+                cursor = next;
             }
-            allocator::operator delete (newNode);
+            this->slab.deallocate(newNode);
             throw;
         }
-        newNode->next = List::getNewNode();
+        newNode->next = this->getNewNode();
         newNode->next->previous = newNode;
         newNode = newNode->next;
     }
     new (&newNode->data) valueType(value);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, constReference);
     newNode->next = first->next;
     first->next->previous = newNode;
     first->next = backup;
+    this->count += inserted;
 }
 template <typename T, typename Allocator>
 template <typename InputIterator,
@@ -221,34 +271,41 @@ inline void DataStructure::List<T, Allocator>::setLink(
         typename __DataStructure_isInputIterator<InputIterator>::__result first,
         InputIterator last, node firstNode
 ) {
-    auto newNode {List::getNewNode()};
+    auto size {IteratorDifference<InputIterator>()(first, last)};
+    if(not size) {
+        return;
+    }
+    const auto inserted {static_cast<sizeType>(size)};
+    auto newNode {this->getNewNode()};
     newNode->previous = firstNode;
     const auto backup {newNode};
-    auto size {IteratorDifference<InputIterator>()(first, last)};
     while(--size) {
         try {
             new (&newNode->data) valueType(static_cast<valueType>(*first++));
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, constReference);
         }catch(...) {
-            while(backup not_eq newNode) {
-                auto next {backup->next};
-                delete backup;
-                backup = next;
+            for(auto cursor {backup}; cursor not_eq newNode;) {
+                auto next {cursor->next};
+                this->deleteNode(cursor);
+                cursor = next;
             }
-            allocator::operator delete (newNode);
+            this->slab.deallocate(newNode);
             throw;
         }
-        newNode->next = List::getNewNode();
+        newNode->next = this->getNewNode();
         newNode->next->previous = newNode;
         newNode = newNode->next;
     }
-    new (&newNode->data) valueType(*static_cast<valueType>(first));
+    new (&newNode->data) valueType(*first);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, constReference);
     newNode->next = firstNode->next;
     firstNode->next->previous = newNode;
     firstNode->next = backup;
+    this->count += inserted;
 }
 template <typename T, typename Allocator>
 DataStructure::List<T, Allocator>::List() :
-        first {List::getNewNode()} {
+        first {List::getNewFirst()}, count {0}, slab {} {
     this->first->next = this->first;
     this->first->previous = this->first;
 }
@@ -279,13 +336,15 @@ DataStructure::List<T, Allocator>::List(std::initializer_list<valueType> list)
 template <typename T, typename Allocator>
 DataStructure::List<T, Allocator>::List(const List &rhs) : List(rhs.cbegin(), rhs.cend()) {}
 template <typename T, typename Allocator>
-DataStructure::List<T, Allocator>::List(List &&rhs) noexcept : first {rhs.first} {
+DataStructure::List<T, Allocator>::List(List &&rhs) noexcept :
+        first {rhs.first}, count {rhs.count}, slab {move(rhs.slab)} {
     rhs.first = nullptr;
+    rhs.count = 0;
 }
 template <typename T, typename Allocator>
 DataStructure::List<T, Allocator>::~List() {
     this->free();
-    allocator::operator delete (this->first);
+    List::deleteFirst(this->first);
 }
 template <typename T, typename Allocator>
 DataStructure::List<T, Allocator> &DataStructure::List<T, Allocator>::operator=(const List &rhs) {
@@ -303,9 +362,13 @@ DataStructure::List<T, Allocator> &DataStructure::List<T, Allocator>::operator=(
         return *this;
     }
     this->free();
-    allocator::operator delete (this->first);
+    List::deleteFirst(this->first);
+    this->slab.release();
     this->first = rhs.first;
+    this->count = rhs.count;
     rhs.first = nullptr;
+    rhs.count = 0;
+    this->slab.swap(rhs.slab);
     return *this;
 }
 template <typename T, typename Allocator>
@@ -392,19 +455,39 @@ template <typename T, typename Allocator>
 inline void DataStructure::List<T, Allocator>::resetFirst() noexcept {
     this->first->next = this->first;
     this->first->previous = this->first;
+    this->count = 0;
+}
+template <typename T, typename Allocator>
+inline typename DataStructure::List<T, Allocator>::node
+DataStructure::List<T, Allocator>::seek(differenceType index) const noexcept {
+    auto offset {static_cast<sizeType>(index)};
+    if(offset >= this->count) {
+        return this->first;
+    }
+    auto cursor {this->first};
+    if(offset < this->count / 2) {
+        for(++offset; offset--; cursor = cursor->next);
+        return cursor;
+    }
+    for(offset = this->count - offset; offset--; cursor = cursor->previous);
+    return cursor;
 }
 template <typename T, typename Allocator>
 void DataStructure::List<T, Allocator>::assign(sizeType size, constReference value) {
     auto cursor {this->first};
     while(cursor->next not_eq this->first and size) {
         cursor = cursor->next;
-        allocator::destroy(&cursor->data);
+        allocator::destroy(static_cast<void *>(&cursor->data));
+        __DATA_STRUCTURE_STATISTICS_COUNT(List, DESTROY);
         new (&cursor->data) valueType(value);
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, constReference);
         --size;
     }
     if(size) {
         this->setLink(size, value, cursor);
+        return;
     }
+    this->erase(constIterator(reinterpret_cast<constNodeType *>(cursor->next)), this->cend());
 }
 template <typename T, typename Allocator>
 template <typename InputIterator,
@@ -417,13 +500,17 @@ void DataStructure::List<T, Allocator>::assign(
     auto size {IteratorDifference<InputIterator>()(first, last)};
     while(cursor->next not_eq this->first and size) {
         cursor = cursor->next;
-        allocator::destroy(&cursor->data);
+        allocator::destroy(static_cast<void *>(&cursor->data));
+        __DATA_STRUCTURE_STATISTICS_COUNT(List, DESTROY);
         new (&cursor->data) valueType(static_cast<valueType>(*first++));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, constReference);
         --size;
     }
     if(size) {
         this->setLink(first, last, cursor);
+        return;
     }
+    this->erase(constIterator(reinterpret_cast<constNodeType *>(cursor->next)), this->cend());
 }
 template <typename T, typename Allocator>
 void DataStructure::List<T, Allocator>::assign(std::initializer_list<valueType> list) {
@@ -481,18 +568,12 @@ DataStructure::List<T, Allocator>::crend() const noexcept {
 }
 template <typename T, typename Allocator>
 bool DataStructure::List<T, Allocator>::empty() const noexcept {
-    return this->operator bool();
+    return this->count == 0;
 }
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::sizeType
 DataStructure::List<T, Allocator>::size() const noexcept {
-    sizeType count {0};
-    auto cursor {this->first};
-    while(cursor->next not_eq this->first) {
-        ++count;
-        cursor = cursor->next;
-    }
-    return count;
+    return this->count;
 }
 template <typename T, typename Allocator>
 void DataStructure::List<T, Allocator>::clear() noexcept(
@@ -506,17 +587,17 @@ void DataStructure::List<T, Allocator>::clear() noexcept(
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::insert(differenceType index, constReference value, sizeType size) {
-    auto cursor {this->first};
-    while(index--) {
-        cursor = cursor->next;
-    }
-    this->setLink(size, value, cursor);
-    return iterator(cursor->next);
+    return this->insert(constIterator(reinterpret_cast<constNodeType *>(this->seek(index))), value, size);
 }
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::insert(constIterator position, constReference value, sizeType size) {
-    return this->insert(IteratorDifference<iterator>()(this->cbegin(), position), value, size);
+    auto cursor {reinterpret_cast<node>(position.iterator)->previous};
+    if(not size) {
+        return iterator(cursor->next);
+    }
+    this->setLink(size, value, cursor);
+    return iterator(cursor->next);
 }
 template <typename T, typename Allocator>
 template <typename InputIterator,
@@ -528,12 +609,7 @@ DataStructure::List<T, Allocator>::insert(
         typename __DataStructure_isInputIterator<InputIterator>::__result first,
         InputIterator last
 ) {
-    auto cursor {this->first};
-    while(index--) {
-        cursor = cursor->next;
-    }
-    this->setLink(first, last, cursor);
-    return iterator(cursor->next);
+    return this->insert(constIterator(reinterpret_cast<constNodeType *>(this->seek(index))), first, last);
 }
 template <typename T, typename Allocator>
 template <typename InputIterator,
@@ -544,73 +620,78 @@ DataStructure::List<T, Allocator>::insert(constIterator position,
         typename __DataStructure_isInputIterator<InputIterator>::__result first,
         InputIterator last
 ) {
-    return this->insert(IteratorDifference<iterator>()(this->cbegin(), position), first, last);
+    auto cursor {reinterpret_cast<node>(position.iterator)->previous};
+    this->setLink(first, last, cursor);
+    return iterator(cursor->next);
 }
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::insert(differenceType index, rightValueReference value) {
-    auto cursor {this->first};
-    while(index--) {
-        cursor = cursor->next;
-    }
-    auto newNode {List::getNewNode()};
+    return this->insert(constIterator(reinterpret_cast<constNodeType *>(this->seek(index))), move(value));
+}
+template <typename T, typename Allocator>
+typename DataStructure::List<T, Allocator>::iterator
+DataStructure::List<T, Allocator>::insert(constIterator position, rightValueReference value) {
+    auto cursor {reinterpret_cast<node>(position.iterator)->previous};
+    auto newNode {this->getNewNode()};
     new (&newNode->data) valueType(move(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, rightValueReference);
     newNode->next = cursor->next;
     newNode->previous = cursor;
     cursor->next->previous = newNode;
     cursor->next = newNode;
+    ++this->count;
     return iterator(newNode);
 }
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::iterator
-DataStructure::List<T, Allocator>::insert(constIterator position, rightValueReference value) {
-    return this->insert(IteratorDifference<constIterator>()(this->cbegin(), position), move(value));
-}
-template <typename T, typename Allocator>
-typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::insert(differenceType index, std::initializer_list<valueType> list) {
     return this->insert(index, list.begin(), list.end());
 }
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::insert(constIterator position, std::initializer_list<valueType> list) {
-    return this->insert(
-                IteratorDifference<constIterator>()(this->cbegin(), position), list.begin(), list.end()
-           );
+    return this->insert(position, list.begin(), list.end());
 }
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::erase(differenceType index, sizeType size) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
-    auto cursor {this->first};
-    while(--index) {
-        cursor = cursor->next;
-    }
-    auto eraseCursor {cursor->next};
-    while(size--) {
-        auto next {eraseCursor->next};
-        delete eraseCursor;
-        eraseCursor = next;
-    }
-    eraseCursor->previous = cursor;
-    cursor->next = eraseCursor;
-    return iterator(cursor);
+    return this->erase(constIterator(reinterpret_cast<constNodeType *>(this->seek(index))), size);
 }
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::erase(constIterator position, sizeType size) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
-    return this->erase(IteratorDifference<constIterator>()(this->cbegin(), position), size);
+    auto eraseCursor {reinterpret_cast<node>(position.iterator)};
+    auto cursor {eraseCursor->previous};
+    for(; size-- and eraseCursor not_eq this->first; --this->count) {
+        auto next {eraseCursor->next};
+        this->deleteNode(eraseCursor);
+        eraseCursor = next;
+    }
+    eraseCursor->previous = cursor;
+    cursor->next = eraseCursor;
+    return iterator(eraseCursor);
 }
 template <typename T, typename Allocator>
 typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::erase(constIterator first, constIterator last) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
-    IteratorDifference<constIterator> iteratorDifference;
-    return this->erase(iteratorDifference(this->cbegin(), first), iteratorDifference(first, last));
+    auto eraseCursor {reinterpret_cast<node>(first.iterator)};
+    auto cursor {eraseCursor->previous};
+    const auto end {reinterpret_cast<node>(last.iterator)};
+    for(; eraseCursor not_eq end; --this->count) {
+        auto next {eraseCursor->next};
+        this->deleteNode(eraseCursor);
+        eraseCursor = next;
+    }
+    end->previous = cursor;
+    cursor->next = end;
+    return iterator(end);
 }
 template <typename T, typename Allocator>
 template <typename ...Args>
@@ -622,9 +703,7 @@ template <typename T, typename Allocator>
 template <typename ...Args>
 typename DataStructure::List<T, Allocator>::iterator
 DataStructure::List<T, Allocator>::emplace(constIterator position, Args &&...args) {
-    return insert(IteratorDifference<constIterator>()(this->cbegin(), position),
-                    valueType(std::forward<Args>(args)...)
-                 );
+    return this->insert(position, valueType(std::forward<Args>(args)...));
 }
 template <typename T, typename Allocator>
 template <typename ...Args>
@@ -640,42 +719,52 @@ template <typename T, typename Allocator>
 void DataStructure::List<T, Allocator>::swap(List &rhs) noexcept {
     using std::swap;
     swap(this->first, rhs.first);
+    swap(this->count, rhs.count);
+    this->slab.swap(rhs.slab);
 }
 template <typename T, typename Allocator>
 void DataStructure::List<T, Allocator>::pushFront(constReference value) {
-    auto newNode {List::getNewNode()};
+    auto newNode {this->getNewNode()};
+    new (&newNode->data) valueType(value);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, constReference);
     newNode->previous = this->first;
     newNode->next = this->first->next;
     this->first->next->previous = newNode;
     this->first->next = newNode;
-    new (&newNode->data) valueType(value);
+    ++this->count;
 }
 template <typename T, typename Allocator>
 void DataStructure::List<T, Allocator>::pushFront(rightValueReference value) {
-    auto newNode {List::getNewNode()};
+    auto newNode {this->getNewNode()};
+    new (&newNode->data) valueType(move(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, rightValueReference);
     newNode->previous = this->first;
     newNode->next = this->first->next;
     this->first->next->previous = newNode;
     this->first->next = newNode;
-    new (&newNode->data) valueType(move(value));
+    ++this->count;
 }
 template <typename T, typename Allocator>
 void DataStructure::List<T, Allocator>::pushBack(constReference value) {
-    auto newNode {List::getNewNode()};
+    auto newNode {this->getNewNode()};
+    new (&newNode->data) valueType(value);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, constReference);
     newNode->next = this->first;
     newNode->previous = this->first->previous;
     this->first->previous->next = newNode;
     this->first->previous = newNode;
-    new (&newNode->data) valueType(value);
+    ++this->count;
 }
 template <typename T, typename Allocator>
 void DataStructure::List<T, Allocator>::pushBack(rightValueReference value) {
-    auto newNode {List::getNewNode()};
+    auto newNode {this->getNewNode()};
+    new (&newNode->data) valueType(move(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(List, rightValueReference);
     newNode->next = this->first;
     newNode->previous = this->first->previous;
     this->first->previous->next = newNode;
     this->first->previous = newNode;
-    new (&newNode->data) valueType(move(value));
+    ++this->count;
 }
 template <typename T, typename Allocator>
 #ifdef POP_GET_OBJECT
@@ -689,10 +778,11 @@ DataStructure::List<T, Allocator>::popBack() noexcept(
     auto pop {this->first->previous};
     this->first->previous = pop->previous;
     pop->previous->next = this->first;
+    --this->count;
 #ifdef POP_GET_OBJECT
     auto value {move(pop->data)};
 #endif
-    delete pop;
+    this->deleteNode(pop);
 #ifdef POP_GET_OBJECT
     return value;
 #endif
@@ -709,14 +799,227 @@ DataStructure::List<T, Allocator>::popFront() noexcept(
     auto pop {this->first->next};
     pop->next->previous = this->first;
     this->first->next = pop->next;
+    --this->count;
 #ifdef POP_GET_OBJECT
     auto value {move(pop->data)};
 #endif
-    delete pop;
+    this->deleteNode(pop);
 #ifdef POP_GET_OBJECT
     return value;
 #endif
 }
+template <typename T, typename Allocator>
+inline void DataStructure::List<T, Allocator>::relink(node chain) noexcept {
+    auto previous {this->first};
+    for(; chain; chain = chain->next) {
+        chain->previous = previous;
+        previous->next = chain;
+        previous = chain;
+    }
+    previous->next = this->first;
+    this->first->previous = previous;
+}
+template <typename T, typename Allocator>
+inline void DataStructure::List<T, Allocator>::transfer(node position, node first, node last) noexcept {
+    auto tail {last->previous};
+    first->previous->next = last;
+    last->previous = first->previous;
+    first->previous = position->previous;
+    position->previous->next = first;
+    tail->next = position;
+    position->previous = tail;
+}
+template <typename T, typename Allocator>
+typename DataStructure::List<T, Allocator>::iterator
+DataStructure::List<T, Allocator>::splice(constIterator position, List &rhs) {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    if(&rhs == this or rhs.first->next == rhs.first) {
+        return iterator(cursor);
+    }
+    this->slab.share(rhs.slab);
+    auto first {rhs.first->next};
+    List::transfer(cursor, first, rhs.first);
+    this->count += rhs.count;
+    rhs.count = 0;
+    return iterator(first);
+}
+template <typename T, typename Allocator>
+typename DataStructure::List<T, Allocator>::iterator
+DataStructure::List<T, Allocator>::splice(constIterator position, List &rhs, constIterator element) {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    auto moved {reinterpret_cast<node>(element.iterator)};
+    if(cursor == moved or cursor == moved->next) {
+        return iterator(moved);
+    }
+    this->slab.share(rhs.slab);
+    List::transfer(cursor, moved, moved->next);
+    ++this->count;
+    --rhs.count;
+    return iterator(moved);
+}
+template <typename T, typename Allocator>
+typename DataStructure::List<T, Allocator>::iterator
+DataStructure::List<T, Allocator>::splice(constIterator position, List &rhs, constIterator first, constIterator last) {
+    auto cursor {reinterpret_cast<node>(position.iterator)};
+    if(first == last) {
+        return iterator(cursor);
+    }
+    this->slab.share(rhs.slab);
+    if(&rhs not_eq this) {
+        const auto moved {static_cast<sizeType>(IteratorDifference<constIterator>()(first, last))};
+        this->count += moved;
+        rhs.count -= moved;
+    }
+    auto moved {reinterpret_cast<node>(first.iterator)};
+    List::transfer(cursor, moved, reinterpret_cast<node>(last.iterator));
+    return iterator(moved);
+}
+template <typename T, typename Allocator>
+void DataStructure::List<T, Allocator>::merge(List &rhs) {
+    this->merge(rhs, [](constReference lhs, constReference rhs) -> bool {
+        return lhs < rhs;
+    });
+}
+template <typename T, typename Allocator>
+template <typename Compare>
+void DataStructure::List<T, Allocator>::merge(List &rhs, Compare compare) {
+    if(&rhs == this or rhs.first->next == rhs.first) {
+        return;
+    }
+    this->slab.share(rhs.slab);
+    auto cursor {this->first->next};
+    auto rhsCursor {rhs.first->next};
+    while(cursor not_eq this->first and rhsCursor not_eq rhs.first) {
+        if(not compare(rhsCursor->data, cursor->data)) {
+            cursor = cursor->next;
+            continue;
+        }
+        auto last {rhsCursor->next};
+        sizeType moved {1};
+        for(; last not_eq rhs.first and compare(last->data, cursor->data); ++moved) {
+            last = last->next;
+        }
+        List::transfer(cursor, rhsCursor, last);
+        this->count += moved;
+        rhs.count -= moved;
+        rhsCursor = last;
+    }
+    if(rhsCursor not_eq rhs.first) {
+        List::transfer(this->first, rhsCursor, rhs.first);
+        this->count += rhs.count;
+        rhs.count = 0;
+    }
+}
+template <typename T, typename Allocator>
+void DataStructure::List<T, Allocator>::sort() {
+    this->sort([](constReference lhs, constReference rhs) -> bool {
+        return lhs < rhs;
+    });
+}
+template <typename T, typename Allocator>
+template <typename Compare>
+void DataStructure::List<T, Allocator>::sort(Compare compare) {
+    auto chain {this->first->next};
+    if(chain == this->first or chain->next == this->first) {
+        return;
+    }
+    this->first->previous->next = nullptr;
+    try {
+        __DataStructure_ChainSorter<nodeType>::sort(chain, compare, __DataStructure_trueType());
+    }catch(...) {
+        this->relink(chain);
+        throw;
+    }
+    const auto last {chain->previous};
+    chain->previous = this->first;
+    this->first->next = chain;
+    last->next = this->first;
+    this->first->previous = last;
+}
+template <typename T, typename Allocator>
+typename DataStructure::List<T, Allocator>::sizeType DataStructure::List<T, Allocator>::unique() {
+    return this->unique([](constReference lhs, constReference rhs) -> bool {
+        return lhs == rhs;
+    });
+}
+template <typename T, typename Allocator>
+template <typename BinaryPredicate>
+typename DataStructure::List<T, Allocator>::sizeType
+DataStructure::List<T, Allocator>::unique(BinaryPredicate predicate) {
+    sizeType removed {0};
+    auto cursor {this->first->next};
+    if(cursor == this->first) {
+        return removed;
+    }
+    for(auto next {cursor->next}; next not_eq this->first; next = cursor->next) {
+        if(not predicate(cursor->data, next->data)) {
+            cursor = next;
+            continue;
+        }
+        cursor->next = next->next;
+        next->next->previous = cursor;
+        this->deleteNode(next);
+        ++removed;
+        --this->count;
+    }
+    return removed;
+}
+template <typename T, typename Allocator>
+typename DataStructure::List<T, Allocator>::sizeType
+DataStructure::List<T, Allocator>::remove(constReference value) {
+    sizeType removed {0};
+    node deferred {nullptr};
+    for(auto cursor {this->first->next}; cursor not_eq this->first;) {
+        auto next {cursor->next};
+        if(cursor->data == value) {
+            if(&cursor->data == &value) {
+                deferred = cursor;
+            }else {
+                cursor->previous->next = next;
+                next->previous = cursor->previous;
+                this->deleteNode(cursor);
+                ++removed;
+                --this->count;
+            }
+        }
+        cursor = next;
+    }
+    if(deferred) {
+        deferred->previous->next = deferred->next;
+        deferred->next->previous = deferred->previous;
+        this->deleteNode(deferred);
+        ++removed;
+        --this->count;
+    }
+    return removed;
+}
+template <typename T, typename Allocator>
+template <typename UnaryPredicate>
+typename DataStructure::List<T, Allocator>::sizeType
+DataStructure::List<T, Allocator>::removeIf(UnaryPredicate predicate) {
+    sizeType removed {0};
+    for(auto cursor {this->first->next}; cursor not_eq this->first;) {
+        auto next {cursor->next};
+        if(predicate(cursor->data)) {
+            cursor->previous->next = next;
+            next->previous = cursor->previous;
+            this->deleteNode(cursor);
+            ++removed;
+            --this->count;
+        }
+        cursor = next;
+    }
+    return removed;
+}
+template <typename T, typename Allocator>
+void DataStructure::List<T, Allocator>::reverse() noexcept {
+    using std::swap;
+    auto cursor {this->first};
+    do {
+        swap(cursor->next, cursor->previous);
+        cursor = cursor->previous;
+    }while(cursor not_eq this->first);
+}
 
 #ifdef DEBUG_DATA_STRUCTURE_FOR_LIST
 template <typename T, typename Allocator>
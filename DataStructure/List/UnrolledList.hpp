@@ -0,0 +1,778 @@
+#ifndef DATA_STRUCTURE_UNROLLED_LIST_HPP
+#define DATA_STRUCTURE_UNROLLED_LIST_HPP
+
+#include "../Allocator.hpp"
+#include "../Iterator.hpp"
+
+namespace DataStructure {
+    template <typename T, unsigned long NodeCapacity = 0, typename Alloc = Allocator<T>>
+    class UnrolledList final {
+    public:
+        using allocator = Alloc;
+        using sizeType = typename allocator::sizeType;
+        using differenceType = typename allocator::differenceType;
+        using valueType = typename allocator::valueType;
+        using reference = typename allocator::reference;
+        using constReference = typename allocator::constReference;
+        using rightValueReference = typename allocator::rightValueReference;
+        using pointer = typename allocator::pointer;
+        using constPointer = typename allocator::constPointer;
+    private:
+        enum : unsigned long {
+            nodeCapacity = NodeCapacity == 0 ? static_cast<unsigned long>(
+                            sizeof(valueType) >= 256 ? 1 : 256 / sizeof(valueType)
+                         ) : NodeCapacity
+        };
+        using nodeType = __DataStructure_UnrolledListNode<valueType, reference, pointer, nodeCapacity>;
+        using constNodeType = __DataStructure_UnrolledListNode<valueType, constReference, constPointer, nodeCapacity>;
+    public:
+        using iterator = __DataStructure_UnrolledListIterator<nodeType>;
+        using constIterator = __DataStructure_UnrolledListIterator<constNodeType>;
+        using reverseIterator = __DataStructure_UnrolledListReverseIterator<nodeType>;
+        using constReverseIterator = __DataStructure_UnrolledListReverseIterator<constNodeType>;
+    private:
+        using node = nodeType *;
+    private:
+        node first;
+        sizeType count;
+    private:
+        static node getNewNode();
+        static void deleteNode(node) noexcept;
+        static void moveElements(pointer, pointer, sizeType, __DataStructure_trueType) noexcept;
+        static void moveElements(pointer, pointer, sizeType, __DataStructure_falseType);
+        static void linkNode(node, node) noexcept;
+        static void unlinkNode(node) noexcept;
+        static bool holds(node, constPointer) noexcept;
+    private:
+        void free() noexcept(
+                static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        );
+        void resetFirst() noexcept;
+        node splitNode(node, sizeType);
+        iterator seek(differenceType) const noexcept;
+        template <typename Type>
+        node insertNewNode(node, Type);
+        template <typename Type>
+        pointer insertAuxiliary(node, sizeType, Type);
+        template <typename Type>
+        iterator insertAuxiliary(constIterator, Type);
+        template <typename Type>
+        void pushBackAuxiliary(Type);
+        template <typename Type>
+        void pushFrontAuxiliary(Type);
+    public:
+        UnrolledList();
+        explicit UnrolledList(sizeType);
+        UnrolledList(sizeType, constReference);
+        template <typename InputIterator,
+                typename __DataStructure_isInputIterator<InputIterator>::__result * = nullptr
+        >
+        UnrolledList(typename __DataStructure_isInputIterator<InputIterator>::__result, InputIterator);
+        UnrolledList(std::initializer_list<valueType>);
+        UnrolledList(const UnrolledList &);
+        UnrolledList(UnrolledList &&) noexcept;
+        ~UnrolledList();
+    public:
+        UnrolledList &operator=(const UnrolledList &);
+        UnrolledList &operator=(UnrolledList &&) noexcept;
+        UnrolledList &operator=(std::initializer_list<valueType>);
+        bool operator==(const UnrolledList &) const;
+        bool operator!=(const UnrolledList &) const;
+        bool operator<(const UnrolledList &) const;
+        bool operator<=(const UnrolledList &) const;
+        bool operator>(const UnrolledList &) const;
+        bool operator>=(const UnrolledList &) const;
+        explicit operator bool() const noexcept;
+        UnrolledList operator+() const;
+        UnrolledList operator-() const;
+    public:
+        void assign(sizeType, constReference = valueType());
+        template <typename InputIterator,
+                typename __DataStructure_isInputIterator<InputIterator>::__result * = nullptr
+        >
+        void assign(typename __DataStructure_isInputIterator<InputIterator>::__result, InputIterator);
+        void assign(std::initializer_list<valueType>);
+        valueType front() const;
+        valueType back() const;
+        iterator begin() const noexcept;
+        constIterator cbegin() const noexcept;
+        reverseIterator rbegin() const noexcept;
+        constReverseIterator crbegin() const noexcept;
+        iterator end() const noexcept;
+        constIterator cend() const noexcept;
+        reverseIterator rend() const noexcept;
+        constReverseIterator crend() const noexcept;
+        bool empty() const noexcept;
+        sizeType size() const noexcept;
+        void clear() noexcept(
+                static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        );
+        iterator insert(differenceType, constReference);
+        iterator insert(differenceType, rightValueReference);
+        iterator insert(constIterator, constReference);
+        iterator insert(constIterator, rightValueReference);
+        iterator erase(differenceType, sizeType = 1);
+        iterator erase(constIterator);
+        iterator erase(constIterator, constIterator);
+        void pushBack(constReference);
+        void pushBack(rightValueReference);
+        void pushFront(constReference);
+        void pushFront(rightValueReference);
+#ifdef POP_GET_OBJECT
+        valueType
+#else
+        void
+#endif
+        popFront();
+#ifdef POP_GET_OBJECT
+        valueType
+#else
+        void
+#endif
+        popBack() noexcept(
+                static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        );
+        template <typename ...Args>
+        iterator emplace(constIterator, Args &&...);
+        template <typename ...Args>
+        iterator emplace(differenceType, Args &&...);
+        template <typename ...Args>
+        void emplaceBack(Args &&...);
+        template <typename ...Args>
+        void emplaceFront(Args &&...);
+        void splice(constIterator, UnrolledList &);
+        void swap(UnrolledList &) noexcept;
+#ifdef DEBUG_DATA_STRUCTURE_FOR_UNROLLED_LIST
+        node &getFirst() noexcept;
+#endif
+    };
+    template <typename T, unsigned long NodeCapacity, typename Alloc>
+    void swap(UnrolledList<T, NodeCapacity, Alloc> &, UnrolledList<T, NodeCapacity, Alloc> &) noexcept;
+}
+
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::swap(UnrolledList<T, NodeCapacity, Allocator> &lhs,
+        UnrolledList<T, NodeCapacity, Allocator> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+inline typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::node
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::getNewNode() {
+    auto newNode {reinterpret_cast<node>(allocator::operator new (sizeof(nodeType)))};
+    __DATA_STRUCTURE_STATISTICS_COUNT(UnrolledList, ALLOCATE);
+    newNode->size = 0;
+    return newNode;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+inline void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::deleteNode(node p) noexcept {
+    allocator::operator delete (p, sizeof(nodeType));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+inline void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::moveElements(
+        pointer destination, pointer source, sizeType size, __DataStructure_trueType
+) noexcept {
+    std::memmove(destination, source, sizeof(valueType) * size);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::moveElements(
+        pointer destination, pointer source, sizeType size, __DataStructure_falseType
+) {
+    if(destination > source) {
+        while(size--) {
+            new (destination + size) valueType(move(source[size]));
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(UnrolledList, rightValueReference);
+            allocator::destroy(static_cast<void *>(source + size));
+            __DATA_STRUCTURE_STATISTICS_COUNT(UnrolledList, DESTROY);
+        }
+        return;
+    }
+    for(auto i {static_cast<sizeType>(0)}; i < size; ++i) {
+        new (destination + i) valueType(move(source[i]));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(UnrolledList, rightValueReference);
+        allocator::destroy(static_cast<void *>(source + i));
+        __DATA_STRUCTURE_STATISTICS_COUNT(UnrolledList, DESTROY);
+    }
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+inline void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::linkNode(node newNode, node next) noexcept {
+    newNode->next = next;
+    newNode->previous = next->previous;
+    next->previous->next = newNode;
+    next->previous = newNode;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+inline void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::unlinkNode(node p) noexcept {
+    p->previous->next = p->next;
+    p->next->previous = p->previous;
+    UnrolledList::deleteNode(p);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+inline bool DataStructure::UnrolledList<T, NodeCapacity, Allocator>::holds(node p, constPointer value) noexcept {
+    return value >= p->begin() and value < p->end();
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::free() noexcept(
+        static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+) {
+    auto cursor {this->first->next};
+    while(cursor not_eq this->first) {
+        const auto next {cursor->next};
+        allocator::destroy(static_cast<void *>(cursor->begin()), static_cast<const void *>(cursor->end()));
+        __DATA_STRUCTURE_STATISTICS_COUNT_N(UnrolledList, DESTROY, cursor->size);
+        UnrolledList::deleteNode(cursor);
+        cursor = next;
+    }
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+inline void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::resetFirst() noexcept {
+    this->first->next = this->first;
+    this->first->previous = this->first;
+    this->count = 0;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::node
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::splitNode(node p, sizeType index) {
+    auto newNode {UnrolledList::getNewNode()};
+    UnrolledList::moveElements(newNode->begin(), p->begin() + static_cast<differenceType>(index), p->size - index,
+            typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable());
+    newNode->size = p->size - index;
+    p->size = index;
+    UnrolledList::linkNode(newNode, p->next);
+    return newNode;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::seek(differenceType index) const noexcept {
+    auto offset {static_cast<sizeType>(index)};
+    if(offset >= this->count) {
+        return this->end();
+    }
+    if(offset < this->count / 2) {
+        auto cursor {this->first->next};
+        while(offset >= cursor->size) {
+            offset -= cursor->size;
+            cursor = cursor->next;
+        }
+        return iterator(cursor->begin() + static_cast<differenceType>(offset), cursor);
+    }
+    offset = this->count - offset;
+    auto cursor {this->first->previous};
+    while(offset > cursor->size) {
+        offset -= cursor->size;
+        cursor = cursor->previous;
+    }
+    return iterator(cursor->end() - static_cast<differenceType>(offset), cursor);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename Type>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::node
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::insertNewNode(node next, Type value) {
+    auto newNode {UnrolledList::getNewNode()};
+    try {
+        new (newNode->begin()) valueType(forward<Type>(value));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(UnrolledList, Type);
+    }catch(...) {
+        UnrolledList::deleteNode(newNode);
+        throw;
+    }
+    newNode->size = 1;
+    UnrolledList::linkNode(newNode, next);
+    ++this->count;
+    return newNode;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename Type>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::pointer
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::insertAuxiliary(node p, sizeType index, Type value) {
+    const auto position {p->begin() + static_cast<differenceType>(index)};
+    const auto size {p->size - index};
+    UnrolledList::moveElements(position + 1, position, size,
+            typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable());
+    try {
+        new (position) valueType(forward<Type>(value));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(UnrolledList, Type);
+    }catch(...) {
+        UnrolledList::moveElements(position, position + 1, size,
+                typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable());
+        throw;
+    }
+    ++p->size;
+    ++this->count;
+    return position;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename Type>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::insertAuxiliary(constIterator position, Type value) {
+    auto p {reinterpret_cast<node>(position.node)};
+    if(p == this->first) {
+        this->pushBackAuxiliary<Type>(forward<Type>(value));
+        return iterator(this->first->previous->end() - 1, this->first->previous);
+    }
+    if(UnrolledList::holds(p, &value)) {
+        valueType copy(forward<Type>(value));
+        return this->insertAuxiliary<rightValueReference>(position, move(copy));
+    }
+    auto index {static_cast<sizeType>(position.iterator - p->begin())};
+    if(not index and p->previous not_eq this->first and p->previous->size < static_cast<sizeType>(nodeCapacity)) {
+        p = p->previous;
+        return iterator(this->insertAuxiliary<Type>(p, p->size, forward<Type>(value)), p);
+    }
+    if(p->size == static_cast<sizeType>(nodeCapacity)) {
+        if(not index) {
+            p = this->insertNewNode<Type>(p, forward<Type>(value));
+            return iterator(p->begin(), p);
+        }
+        const auto half {static_cast<sizeType>(nodeCapacity) / 2};
+        const auto newNode {this->splitNode(p, half)};
+        if(index > half) {
+            p = newNode;
+            index -= half;
+        }
+    }
+    return iterator(this->insertAuxiliary<Type>(p, index, forward<Type>(value)), p);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename Type>
+inline void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::pushBackAuxiliary(Type value) {
+    const auto back {this->first->previous};
+    if(back not_eq this->first and back->size not_eq static_cast<sizeType>(nodeCapacity)) {
+        new (back->end()) valueType(forward<Type>(value));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(UnrolledList, Type);
+        ++back->size;
+        ++this->count;
+        return;
+    }
+    this->insertNewNode<Type>(this->first, forward<Type>(value));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename Type>
+inline void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::pushFrontAuxiliary(Type value) {
+    const auto front {this->first->next};
+    if(front not_eq this->first and front->size not_eq static_cast<sizeType>(nodeCapacity)) {
+        if(UnrolledList::holds(front, &value)) {
+            valueType copy(forward<Type>(value));
+            this->insertAuxiliary<rightValueReference>(front, 0, move(copy));
+            return;
+        }
+        this->insertAuxiliary<Type>(front, 0, forward<Type>(value));
+        return;
+    }
+    this->insertNewNode<Type>(front, forward<Type>(value));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::UnrolledList() :
+        first {UnrolledList::getNewNode()}, count {0} {
+    this->resetFirst();
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::UnrolledList(sizeType size) :
+        UnrolledList(size, valueType()) {}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::UnrolledList(sizeType size, constReference value) :
+        UnrolledList() {
+    while(size--) {
+        this->pushBack(value);
+    }
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename InputIterator,
+        typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
+>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::UnrolledList(
+        typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
+) : UnrolledList() {
+    while(first not_eq last) {
+        this->pushBack(*first++);
+    }
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::UnrolledList(std::initializer_list<valueType> list) :
+        UnrolledList(list.begin(), list.end()) {}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::UnrolledList(const UnrolledList &rhs) :
+        UnrolledList(rhs.cbegin(), rhs.cend()) {}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::UnrolledList(UnrolledList &&rhs) noexcept :
+        first {rhs.first}, count {rhs.count} {
+    rhs.first = nullptr;
+    rhs.count = 0;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::~UnrolledList() {
+    if(this->first) {
+        this->free();
+        UnrolledList::deleteNode(this->first);
+    }
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator> &
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator=(const UnrolledList &rhs) {
+    if(&rhs not_eq this) {
+        this->assign(rhs.cbegin(), rhs.cend());
+    }
+    return *this;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator> &
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator=(UnrolledList &&rhs) noexcept {
+    if(&rhs == this) {
+        return *this;
+    }
+    if(this->first) {
+        this->free();
+        UnrolledList::deleteNode(this->first);
+    }
+    this->first = rhs.first;
+    this->count = rhs.count;
+    rhs.first = nullptr;
+    rhs.count = 0;
+    return *this;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator> &
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator=(std::initializer_list<valueType> list) {
+    this->assign(list.begin(), list.end());
+    return *this;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+bool DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator==(const UnrolledList &rhs) const {
+    if(this->count not_eq rhs.count) {
+        return false;
+    }
+    const auto lhsEnd {this->cend()};
+    for(auto lhsIt {this->cbegin()}, rhsIt {rhs.cbegin()}; lhsIt not_eq lhsEnd; ++lhsIt, ++rhsIt) {
+        if(not(*lhsIt == *rhsIt)) {
+            return false;
+        }
+    }
+    return true;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+bool DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator!=(const UnrolledList &rhs) const {
+    return not(*this == rhs);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+bool DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator<(const UnrolledList &rhs) const {
+    const auto size {this->count < rhs.count ? this->count : rhs.count};
+    auto lhsIt {this->cbegin()};
+    auto rhsIt {rhs.cbegin()};
+    for(auto i {static_cast<sizeType>(0)}; i < size; ++i, ++lhsIt, ++rhsIt) {
+        if(*lhsIt == *rhsIt) {
+            continue;
+        }
+        return *lhsIt < *rhsIt;
+    }
+    return this->count <= rhs.count;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+bool DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator<=(const UnrolledList &rhs) const {
+    return *this < rhs or *this == rhs;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+bool DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator>(const UnrolledList &rhs) const {
+    return not(*this <= rhs);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+bool DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator>=(const UnrolledList &rhs) const {
+    return not(*this < rhs);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator bool() const noexcept {
+    return not this->empty();
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator+() const {
+    auto temp {*this};
+    for(auto &c : temp) {
+        c = +c;
+    }
+    return temp;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::operator-() const {
+    auto temp {*this};
+    for(auto &c : temp) {
+        c = -c;
+    }
+    return temp;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::assign(sizeType size, constReference value) {
+    this->clear();
+    while(size--) {
+        this->pushBack(value);
+    }
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename InputIterator,
+        typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
+>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::assign(
+        typename __DataStructure_isInputIterator<InputIterator>::__result first, InputIterator last
+) {
+    this->clear();
+    while(first not_eq last) {
+        this->pushBack(*first++);
+    }
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::assign(std::initializer_list<valueType> list) {
+    this->assign(list.begin(), list.end());
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::valueType
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::front() const {
+    return *this->first->next->begin();
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::valueType
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::back() const {
+    return *(this->first->previous->end() - 1);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::begin() const noexcept {
+    return iterator(this->first->next->begin(), this->first->next);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::constIterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::cbegin() const noexcept {
+    return static_cast<constIterator>(this->begin());
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::reverseIterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::rbegin() const noexcept {
+    return reverseIterator(--this->end());
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::constReverseIterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::crbegin() const noexcept {
+    return constReverseIterator(--this->cend());
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::end() const noexcept {
+    return iterator(this->first->begin(), this->first);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::constIterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::cend() const noexcept {
+    return static_cast<constIterator>(this->end());
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::reverseIterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::rend() const noexcept {
+    return reverseIterator(this->end());
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::constReverseIterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::crend() const noexcept {
+    return constReverseIterator(this->cend());
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+bool DataStructure::UnrolledList<T, NodeCapacity, Allocator>::empty() const noexcept {
+    return not this->count;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::sizeType
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::size() const noexcept {
+    return this->count;
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::clear() noexcept(
+        static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+) {
+    this->free();
+    this->resetFirst();
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::insert(differenceType index, constReference value) {
+    return this->insertAuxiliary<constReference>(static_cast<constIterator>(this->seek(index)), value);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::insert(differenceType index, rightValueReference value) {
+    return this->insertAuxiliary<rightValueReference>(static_cast<constIterator>(this->seek(index)), move(value));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::insert(constIterator position, constReference value) {
+    return this->insertAuxiliary<constReference>(position, value);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::insert(constIterator position, rightValueReference value) {
+    return this->insertAuxiliary<rightValueReference>(position, move(value));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::erase(differenceType index, sizeType size) {
+    auto cursor {static_cast<constIterator>(this->seek(index))};
+    while(size--) {
+        cursor = this->erase(cursor);
+    }
+    return static_cast<iterator>(cursor);
+}
+/*
+ * The erased node is merged with the next node when it is less than half full and both fit in one node,
+ * so the nodes stay dense after erasing many elements.
+ */
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::erase(constIterator position) {
+    const auto p {reinterpret_cast<node>(position.node)};
+    const auto erasePosition {const_cast<pointer>(position.iterator)};
+    const auto index {static_cast<sizeType>(erasePosition - p->begin())};
+    allocator::destroy(static_cast<void *>(erasePosition));
+    __DATA_STRUCTURE_STATISTICS_COUNT(UnrolledList, DESTROY);
+    UnrolledList::moveElements(erasePosition, erasePosition + 1, p->size - index - 1,
+            typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable());
+    --p->size;
+    --this->count;
+    auto next {p->next};
+    if(not p->size) {
+        UnrolledList::unlinkNode(p);
+        return iterator(next->begin(), next);
+    }
+    if(next not_eq this->first and p->size < static_cast<sizeType>(nodeCapacity) / 2 and
+            p->size + next->size <= static_cast<sizeType>(nodeCapacity)) {
+        UnrolledList::moveElements(p->end(), next->begin(), next->size,
+                typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable());
+        p->size += next->size;
+        UnrolledList::unlinkNode(next);
+        next = p->next;
+    }
+    if(index == p->size) {
+        return iterator(next->begin(), next);
+    }
+    return iterator(p->begin() + static_cast<differenceType>(index), p);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::erase(constIterator first, constIterator last) {
+    auto size {IteratorDifference<constIterator>()(first, last)};
+    while(size--) {
+        first = this->erase(first);
+    }
+    return static_cast<iterator>(first);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::pushBack(constReference value) {
+    this->pushBackAuxiliary<constReference>(value);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::pushBack(rightValueReference value) {
+    this->pushBackAuxiliary<rightValueReference>(move(value));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::pushFront(constReference value) {
+    this->pushFrontAuxiliary<constReference>(value);
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::pushFront(rightValueReference value) {
+    this->pushFrontAuxiliary<rightValueReference>(move(value));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+#ifdef POP_GET_OBJECT
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::valueType
+#else
+void
+#endif
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::popFront() {
+#ifdef POP_GET_OBJECT
+    auto temp {move(*this->first->next->begin())};
+#endif
+    this->erase(this->cbegin());
+#ifdef POP_GET_OBJECT
+    return temp;
+#endif
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+#ifdef POP_GET_OBJECT
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::valueType
+#else
+void
+#endif
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::popBack() noexcept(
+        static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+) {
+    const auto back {this->first->previous};
+#ifdef POP_GET_OBJECT
+    auto temp {move(*(back->end() - 1))};
+#endif
+    allocator::destroy(static_cast<void *>(back->end() - 1));
+    __DATA_STRUCTURE_STATISTICS_COUNT(UnrolledList, DESTROY);
+    --this->count;
+    if(not --back->size) {
+        UnrolledList::unlinkNode(back);
+    }
+#ifdef POP_GET_OBJECT
+    return temp;
+#endif
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename ...Args>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::emplace(constIterator position, Args &&...args) {
+    return this->insert(position, valueType(std::forward<Args>(args)...));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename ...Args>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::iterator
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::emplace(differenceType index, Args &&...args) {
+    return this->insert(index, valueType(std::forward<Args>(args)...));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename ...Args>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::emplaceBack(Args &&...args) {
+    this->pushBack(valueType(std::forward<Args>(args)...));
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+template <typename ...Args>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::emplaceFront(Args &&...args) {
+    this->pushFront(valueType(std::forward<Args>(args)...));
+}
+/*
+ * Splicing at the border of two nodes only relinks the nodes of rhs, otherwise the node holding the position
+ * is split first, which moves no more than one node of elements.
+ */
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::splice(constIterator position, UnrolledList &rhs) {
+    if(&rhs == this or rhs.empty()) {
+        return;
+    }
+    auto next {reinterpret_cast<node>(position.node)};
+    const auto index {static_cast<sizeType>(position.iterator - next->begin())};
+    if(index) {
+        next = this->splitNode(next, index);
+    }
+    const auto head {rhs.first->next};
+    const auto tail {rhs.first->previous};
+    head->previous = next->previous;
+    next->previous->next = head;
+    tail->next = next;
+    next->previous = tail;
+    this->count += rhs.count;
+    rhs.resetFirst();
+}
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+void DataStructure::UnrolledList<T, NodeCapacity, Allocator>::swap(UnrolledList &rhs) noexcept {
+    using std::swap;
+    swap(this->first, rhs.first);
+    swap(this->count, rhs.count);
+}
+
+#ifdef DEBUG_DATA_STRUCTURE_FOR_UNROLLED_LIST
+template <typename T, unsigned long NodeCapacity, typename Allocator>
+typename DataStructure::UnrolledList<T, NodeCapacity, Allocator>::node &
+DataStructure::UnrolledList<T, NodeCapacity, Allocator>::getFirst() noexcept {
+    return this->first;
+}
+#endif
+
+#endif //DATA_STRUCTURE_UNROLLED_LIST_HPP
@@ -0,0 +1,663 @@
+#ifndef DATA_STRUCTURE_MONOTONIC_ARENA_ALLOCATOR_HPP
+#define DATA_STRUCTURE_MONOTONIC_ARENA_ALLOCATOR_HPP
+
+#include "Exception.hpp"
+#include "Statistics.hpp"
+#include "TypeTraits.hpp"
+
+namespace DataStructure {
+    template <typename = void>
+    class __DataStructure_MonotonicArena final {
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+    private:
+        struct block {
+            block *previous;
+            sizeType size;
+        };
+    public:
+        enum : sizeType {
+            defaultBlockSize = 4096
+        };
+    private:
+        block *head;
+        block *spare;
+        char *cursor;
+        char *last;
+        char *buffer;
+        sizeType bufferSize;
+        sizeType blockSize;
+    private:
+        static thread_local __DataStructure_MonotonicArena *currentArena;
+    private:
+        static char *align(char *, sizeType) noexcept;
+        static void freeBlocks(block *) noexcept;
+        void grow(sizeType, sizeType);
+    public:
+        explicit __DataStructure_MonotonicArena(sizeType = defaultBlockSize) noexcept;
+        __DataStructure_MonotonicArena(void *, sizeType) noexcept;
+        __DataStructure_MonotonicArena(const __DataStructure_MonotonicArena &) = delete;
+        __DataStructure_MonotonicArena(__DataStructure_MonotonicArena &&) noexcept = delete;
+        ~__DataStructure_MonotonicArena();
+    public:
+        __DataStructure_MonotonicArena &operator=(const __DataStructure_MonotonicArena &) = delete;
+        __DataStructure_MonotonicArena &operator=(__DataStructure_MonotonicArena &&) noexcept = delete;
+    public:
+        void *allocate(sizeType, sizeType = alignof(long double));
+        bool extend(void *, sizeType, sizeType) noexcept;
+        void reset() noexcept;
+        sizeType used() const noexcept;
+    public:
+        static __DataStructure_MonotonicArena &current() noexcept;
+        static __DataStructure_MonotonicArena *bind(__DataStructure_MonotonicArena *) noexcept;
+    };
+    using MonotonicArena = __DataStructure_MonotonicArena<>;
+
+    template <typename T>
+    class MonotonicArenaAllocator {
+    private:
+        class BadPointer;
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = valueType &;
+        using constReference = const valueType &;
+        using rightValueReference = valueType &&;
+        using pointer = valueType *;
+        using constPointer = const valueType *;
+    public:
+        using __DataStructure_isForwardAllocator = __DataStructure_trueType;
+        using __DataStructure_isReverseAllocator = __DataStructure_falseType;
+    private:
+        sizeType allocateSize;
+        pointer first;
+        pointer cursor;
+        MonotonicArena *arena;
+    private:
+        static constexpr sizeType nodeAlignment() noexcept;
+        static void destroy(void *, __DataStructure_falseType);
+        static void destroy(void *, __DataStructure_trueType) noexcept;
+        static void destroy(void *, void *, __DataStructure_falseType);
+        static void destroy(const void *, const void *, __DataStructure_trueType) noexcept;
+    public:
+        static void *operator new (sizeType);
+        static void operator delete (void *, sizeType) noexcept;
+        static void destroy(void *) noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
+        static void destroy(void *, const void *) noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
+    private:
+        void copyRHS(const MonotonicArenaAllocator &);
+        void free(pointer) noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
+        void reallocate(sizeType);
+        void check(pointer) const;
+    public:
+        MonotonicArenaAllocator() noexcept;
+        explicit MonotonicArenaAllocator(MonotonicArena &) noexcept;
+        MonotonicArenaAllocator(const MonotonicArenaAllocator &);
+        MonotonicArenaAllocator(MonotonicArenaAllocator &&) noexcept;
+        ~MonotonicArenaAllocator();
+    public:
+        MonotonicArenaAllocator &operator=(const MonotonicArenaAllocator &) &;
+        MonotonicArenaAllocator &operator=(MonotonicArenaAllocator &&) & noexcept;
+        bool operator==(const MonotonicArenaAllocator &) const;
+        bool operator!=(const MonotonicArenaAllocator &) const;
+        bool operator<(const MonotonicArenaAllocator &) const = delete;
+        bool operator<=(const MonotonicArenaAllocator &) const = delete;
+        bool operator>(const MonotonicArenaAllocator &) const = delete;
+        bool operator>=(const MonotonicArenaAllocator &) const = delete;
+        explicit operator bool() const noexcept;
+    public:
+        pointer allocate(sizeType = 64) &;
+        pointer construct(pointer, constReference) & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+                    )
+                );
+        pointer construct(pointer, rightValueReference) & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+                    )
+                );
+        template <typename ...Args>
+        pointer construct(pointer, Args &&...) &;
+        pointer destroy(pointer) & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+        );
+        pointer destroy(pointer, constPointer) & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+        );
+        bool full() const & noexcept;
+        bool empty() const & noexcept;
+        sizeType size() const & noexcept;
+        sizeType capacity() const & noexcept;
+        sizeType reserve() const & noexcept;
+        pointer begin() const & noexcept;
+        constPointer getCursor() const & noexcept;
+        pointer &getCursor() & noexcept;
+        pointer end() const & noexcept;
+        pointer resize(sizeType) &;
+        pointer shrinkToFit() &;
+        void swap(MonotonicArenaAllocator &) noexcept;
+        pointer clear() & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
+        MonotonicArena &getArena() const & noexcept;
+    };
+    template <typename T>
+    void swap(MonotonicArenaAllocator<T> &, MonotonicArenaAllocator<T> &) noexcept;
+}
+
+template <typename Tag>
+thread_local DataStructure::__DataStructure_MonotonicArena<Tag> *
+DataStructure::__DataStructure_MonotonicArena<Tag>::currentArena {nullptr};
+
+template <typename Tag>
+inline char *DataStructure::__DataStructure_MonotonicArena<Tag>::align(char *p, sizeType alignment) noexcept {
+    const auto address {reinterpret_cast<sizeType>(p)};
+    return p + static_cast<differenceType>(((address + alignment - 1) & ~(alignment - 1)) - address);
+}
+template <typename Tag>
+void DataStructure::__DataStructure_MonotonicArena<Tag>::freeBlocks(block *p) noexcept {
+    while(p) {
+        auto previous {p->previous};
+        ::operator delete (p);
+        p = previous;
+    }
+}
+template <typename Tag>
+void DataStructure::__DataStructure_MonotonicArena<Tag>::grow(sizeType size, sizeType alignment) {
+    const auto minimum {sizeof(block) + size + alignment};
+    block *newBlock {nullptr};
+    if(this->spare and this->spare->size >= minimum) {
+        newBlock = this->spare;
+        this->spare = nullptr;
+    }else {
+        auto bytes {this->head ? this->head->size * 2 : this->blockSize};
+        while(bytes < minimum) {
+            bytes *= 2;
+        }
+        newBlock = reinterpret_cast<block *>(::operator new (bytes));
+        newBlock->size = bytes;
+    }
+    newBlock->previous = this->head;
+    this->head = newBlock;
+    this->cursor = reinterpret_cast<char *>(newBlock) + sizeof(block);
+    this->last = reinterpret_cast<char *>(newBlock) + newBlock->size;
+}
+template <typename Tag>
+DataStructure::__DataStructure_MonotonicArena<Tag>::__DataStructure_MonotonicArena(sizeType blockSize) noexcept :
+        head {nullptr}, spare {nullptr}, cursor {nullptr}, last {nullptr}, buffer {nullptr},
+        bufferSize {0}, blockSize {blockSize > sizeof(block) ? blockSize : defaultBlockSize} {}
+template <typename Tag>
+DataStructure::__DataStructure_MonotonicArena<Tag>::__DataStructure_MonotonicArena(void *buffer, sizeType size)
+        noexcept : head {nullptr}, spare {nullptr}, cursor {reinterpret_cast<char *>(buffer)},
+        last {reinterpret_cast<char *>(buffer) + size}, buffer {reinterpret_cast<char *>(buffer)},
+        bufferSize {size}, blockSize {size > sizeof(block) ? size : defaultBlockSize} {}
+template <typename Tag>
+DataStructure::__DataStructure_MonotonicArena<Tag>::~__DataStructure_MonotonicArena() {
+    if(currentArena == this) {
+        currentArena = nullptr;
+    }
+    __DataStructure_MonotonicArena::freeBlocks(this->head);
+    __DataStructure_MonotonicArena::freeBlocks(this->spare);
+}
+template <typename Tag>
+void *DataStructure::__DataStructure_MonotonicArena<Tag>::allocate(sizeType size, sizeType alignment) {
+    if(not size) {
+        size = 1;
+    }
+    auto result {__DataStructure_MonotonicArena::align(this->cursor, alignment)};
+    if(not this->cursor or result + static_cast<differenceType>(size) > this->last) {
+        this->grow(size, alignment);
+        result = __DataStructure_MonotonicArena::align(this->cursor, alignment);
+    }
+    this->cursor = result + static_cast<differenceType>(size);
+    return result;
+}
+template <typename Tag>
+bool DataStructure::__DataStructure_MonotonicArena<Tag>::extend(void *p, sizeType oldSize, sizeType newSize) noexcept {
+    auto first {reinterpret_cast<char *>(p)};
+    if(first + static_cast<differenceType>(oldSize) not_eq this->cursor or
+            first + static_cast<differenceType>(newSize) > this->last) {
+        return false;
+    }
+    this->cursor = first + static_cast<differenceType>(newSize);
+    return true;
+}
+template <typename Tag>
+void DataStructure::__DataStructure_MonotonicArena<Tag>::reset() noexcept {
+    auto largest {this->spare};
+    for(auto cursor {this->head}; cursor;) {
+        auto previous {cursor->previous};
+        if(not largest or cursor->size > largest->size) {
+            ::operator delete (largest);
+            largest = cursor;
+        }else {
+            ::operator delete (cursor);
+        }
+        cursor = previous;
+    }
+    this->head = nullptr;
+    this->spare = nullptr;
+    if(this->buffer) {
+        this->spare = largest;
+        this->cursor = this->buffer;
+        this->last = this->buffer + static_cast<differenceType>(this->bufferSize);
+        return;
+    }
+    this->cursor = this->last = nullptr;
+    if(largest) {
+        this->spare = largest;
+        this->grow(0, 1);
+    }
+}
+template <typename Tag>
+typename DataStructure::__DataStructure_MonotonicArena<Tag>::sizeType
+DataStructure::__DataStructure_MonotonicArena<Tag>::used() const noexcept {
+    if(not this->head) {
+        return static_cast<sizeType>(this->cursor - this->buffer);
+    }
+    auto size {static_cast<sizeType>(this->cursor - reinterpret_cast<char *>(this->head))};
+    for(auto cursor {this->head->previous}; cursor; cursor = cursor->previous) {
+        size += cursor->size;
+    }
+    return size + this->bufferSize;
+}
+template <typename Tag>
+DataStructure::__DataStructure_MonotonicArena<Tag> &
+DataStructure::__DataStructure_MonotonicArena<Tag>::current() noexcept {
+    if(currentArena) {
+        return *currentArena;
+    }
+    static thread_local __DataStructure_MonotonicArena defaultArena {};
+    return defaultArena;
+}
+template <typename Tag>
+DataStructure::__DataStructure_MonotonicArena<Tag> *
+DataStructure::__DataStructure_MonotonicArena<Tag>::bind(__DataStructure_MonotonicArena *arena) noexcept {
+    auto previous {currentArena};
+    currentArena = arena;
+    return previous;
+}
+
+template <typename T>
+class DataStructure::MonotonicArenaAllocator<T>::BadPointer : public DataStructure::RuntimeException {
+public:
+    explicit BadPointer(const char *error) : RuntimeException(error) {}
+    explicit BadPointer(const std::string &error) : RuntimeException(error) {}
+};
+
+template <typename T>
+inline void DataStructure::swap(MonotonicArenaAllocator<T> &lhs, MonotonicArenaAllocator<T> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+template <typename T>
+inline constexpr typename DataStructure::MonotonicArenaAllocator<T>::sizeType
+DataStructure::MonotonicArenaAllocator<T>::nodeAlignment() noexcept {
+    return alignof(valueType) > alignof(void *) ? alignof(valueType) : alignof(void *);
+}
+template <typename T>
+inline void DataStructure::MonotonicArenaAllocator<T>::destroy(void *p, __DataStructure_falseType) {
+    reinterpret_cast<pointer>(p)->~valueType();
+}
+template <typename T>
+inline void DataStructure::MonotonicArenaAllocator<T>::destroy(void *, __DataStructure_trueType) noexcept {}
+template <typename T>
+inline void DataStructure::MonotonicArenaAllocator<T>::destroy(
+        const void *, const void *, __DataStructure_trueType) noexcept {}
+template <typename T>
+inline void DataStructure::MonotonicArenaAllocator<T>::destroy(void *first, void *last, __DataStructure_falseType) {
+    auto begin {reinterpret_cast<pointer>(first)};
+    auto cursor {reinterpret_cast<pointer>(last)};
+    while(cursor not_eq begin) {
+        (--cursor)->~valueType();
+    }
+}
+template <typename T>
+inline void DataStructure::MonotonicArenaAllocator<T>::copyRHS(const MonotonicArenaAllocator<T> &rhs) {
+    for(auto cursor {rhs.first}; cursor not_eq rhs.cursor;) {
+        new (this->cursor++) valueType(*cursor++);
+    }
+}
+template <typename T>
+inline void DataStructure::MonotonicArenaAllocator<T>::free(pointer p) noexcept(
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        ) {
+    if(not p) {
+        return;
+    }
+    MonotonicArenaAllocator::destroy(
+            p, this->cursor, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+    );
+}
+template <typename T>
+inline void DataStructure::MonotonicArenaAllocator<T>::reallocate(sizeType oldSize) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, REALLOCATE);
+    if(this->first and this->arena->extend(
+            this->first, sizeof(valueType) * oldSize, sizeof(valueType) * this->allocateSize)) {
+        return;
+    }
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, ALLOCATE);
+    auto newFirst {reinterpret_cast<pointer>(
+                        this->arena->allocate(sizeof(valueType) * this->allocateSize, alignof(valueType))
+                  )};
+    auto cursor {this->first};
+    for(auto i {0}; cursor not_eq this->cursor;) {
+        new (newFirst + i++) valueType(move(*cursor++));
+    }
+    const auto size {this->cursor - this->first};
+    this->free(this->first);
+    this->first = newFirst;
+    this->cursor = this->first + size;
+}
+template <typename T>
+inline void DataStructure::MonotonicArenaAllocator<T>::check(pointer p) const {
+    if(p - this->first < 0 or p - this->end() >= 0) {
+        throw BadPointer("The pointer is not allocated by MonotonicArenaAllocator!");
+    }
+}
+template <typename T>
+void *DataStructure::MonotonicArenaAllocator<T>::operator new (sizeType size) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, ALLOCATE);
+    return MonotonicArena::current().allocate(size, MonotonicArenaAllocator::nodeAlignment());
+}
+template <typename T>
+void DataStructure::MonotonicArenaAllocator<T>::operator delete (void *, sizeType) noexcept {}
+template <typename T>
+void DataStructure::MonotonicArenaAllocator<T>::destroy(void *p) noexcept(
+            static_cast<bool>(
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+            )
+        ) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, DESTROY);
+    MonotonicArenaAllocator::destroy(p,
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+               );
+}
+template <typename T>
+void DataStructure::MonotonicArenaAllocator<T>::destroy(void *first, const void *last) noexcept(
+            static_cast<bool>(
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+            )
+        ) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, DESTROY);
+    MonotonicArenaAllocator::destroy(first, const_cast<void *>(last),
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+               );
+}
+template <typename T>
+DataStructure::MonotonicArenaAllocator<T>::MonotonicArenaAllocator() noexcept :
+        allocateSize {0}, first {nullptr}, cursor {nullptr}, arena {&MonotonicArena::current()} {}
+template <typename T>
+DataStructure::MonotonicArenaAllocator<T>::MonotonicArenaAllocator(MonotonicArena &arena) noexcept :
+        allocateSize {0}, first {nullptr}, cursor {nullptr}, arena {&arena} {}
+template <typename T>
+DataStructure::MonotonicArenaAllocator<T>::MonotonicArenaAllocator(const MonotonicArenaAllocator<T> &rhs) :
+        allocateSize {rhs.allocateSize}, first {nullptr}, cursor {nullptr}, arena {rhs.arena} {
+    if(not rhs.first) {
+        return;
+    }
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, ALLOCATE);
+    this->first = reinterpret_cast<pointer>(
+            this->arena->allocate(sizeof(valueType) * this->allocateSize, alignof(valueType))
+    );
+    this->cursor = this->first;
+    this->copyRHS(rhs);
+}
+template <typename T>
+DataStructure::MonotonicArenaAllocator<T>::MonotonicArenaAllocator(MonotonicArenaAllocator<T> &&rhs) noexcept :
+        allocateSize {rhs.allocateSize}, first {rhs.first}, cursor {rhs.cursor}, arena {rhs.arena} {
+    rhs.first = nullptr;
+}
+template <typename T>
+DataStructure::MonotonicArenaAllocator<T>::~MonotonicArenaAllocator() {
+    this->free(this->first);
+}
+template <typename T>
+DataStructure::MonotonicArenaAllocator<T> &
+DataStructure::MonotonicArenaAllocator<T>::operator=(const MonotonicArenaAllocator &rhs) & {
+    if(&rhs == this) {
+        return *this;
+    }
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, ALLOCATE);
+    auto newFirst {reinterpret_cast<pointer>(
+                        this->arena->allocate(sizeof(valueType) * rhs.allocateSize, alignof(valueType))
+                  )};
+    this->free(this->first);
+    this->first = this->cursor = newFirst;
+    this->allocateSize = rhs.allocateSize;
+    this->copyRHS(rhs);
+    return *this;
+}
+template <typename T>
+DataStructure::MonotonicArenaAllocator<T> &
+DataStructure::MonotonicArenaAllocator<T>::operator=(MonotonicArenaAllocator &&rhs) & noexcept {
+    if(&rhs == this) {
+        return *this;
+    }
+    this->free(this->first);
+    this->first = rhs.first;
+    this->allocateSize = rhs.allocateSize;
+    this->cursor = rhs.cursor;
+    this->arena = rhs.arena;
+    rhs.first = nullptr;
+    return *this;
+}
+template <typename T>
+bool DataStructure::MonotonicArenaAllocator<T>::operator==(const MonotonicArenaAllocator &rhs) const {
+    if(this->allocateSize not_eq rhs.allocateSize or this->size() not_eq rhs.size()) {
+        return false;
+    }
+    auto lhsCursor {this->first};
+    auto rhsCursor {rhs.first};
+    while(lhsCursor not_eq this->cursor) {
+        if(*lhsCursor++ not_eq *rhsCursor++) {
+            return false;
+        }
+    }
+    return true;
+}
+template <typename T>
+bool DataStructure::MonotonicArenaAllocator<T>::operator!=(const MonotonicArenaAllocator &rhs) const {
+    return not(*this == rhs);
+}
+template <typename T>
+DataStructure::MonotonicArenaAllocator<T>::operator bool() const noexcept {
+    return this->allocateSize not_eq static_cast<sizeType>(0);
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::allocate(sizeType size) & {
+    if(not size) {
+        size = sizeof(valueType) < 128ul ? 64ul : 8ul;
+    }
+    if(this->first) {
+        if(size <= this->allocateSize) {
+            return this->first;
+        }
+        this->resize(size);
+        return this->first;
+    }
+    this->allocateSize = size;
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, ALLOCATE);
+    this->first = reinterpret_cast<pointer>(
+            this->arena->allocate(sizeof(valueType) * this->allocateSize, alignof(valueType))
+    );
+    this->cursor = this->first;
+    return this->first;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::construct(pointer p, constReference value) & noexcept(
+            static_cast<bool>(
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+            )
+) {
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(MonotonicArenaAllocator, constReference);
+    this->check(p);
+    new (p) valueType(value);
+    if(p == this->cursor) {
+        ++this->cursor;
+    }
+    return this->cursor;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::construct(pointer p, rightValueReference value) & noexcept(
+            static_cast<bool>(
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+            )
+) {
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(MonotonicArenaAllocator, rightValueReference);
+    this->check(p);
+    new (p) valueType(move(value));
+    if(p == this->cursor) {
+        ++this->cursor;
+    }
+    return this->cursor;
+}
+template <typename T>
+template <typename ...Args>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::construct(pointer p, Args &&...args) & {
+    return this->construct(p, valueType(std::forward<Args>(args)...));
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::destroy(pointer p) & noexcept(
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        ) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, DESTROY);
+    MonotonicArenaAllocator::destroy(p, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor());
+    if(this->cursor - 1 == p) {
+        --this->cursor;
+    }
+    return this->cursor;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::destroy(pointer first, constPointer last) & noexcept(
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        ) {
+    __DATA_STRUCTURE_STATISTICS_COUNT(MonotonicArenaAllocator, DESTROY);
+    MonotonicArenaAllocator::destroy(
+            first, const_cast<pointer>(last), typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+    );
+    if(this->cursor == last) {
+        this->cursor = first;
+    }
+    return this->cursor;
+}
+template <typename T>
+bool DataStructure::MonotonicArenaAllocator<T>::full() const & noexcept {
+    return this->cursor - this->first == static_cast<differenceType>(this->allocateSize);
+}
+template <typename T>
+bool DataStructure::MonotonicArenaAllocator<T>::empty() const & noexcept {
+    return this->cursor == this->first;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::sizeType
+DataStructure::MonotonicArenaAllocator<T>::size() const & noexcept {
+    return static_cast<sizeType>(this->cursor - this->first);
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::sizeType
+DataStructure::MonotonicArenaAllocator<T>::capacity() const & noexcept {
+    return this->allocateSize;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::sizeType
+DataStructure::MonotonicArenaAllocator<T>::reserve() const & noexcept {
+    return static_cast<sizeType>(this->end() - this->cursor);
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::begin() const & noexcept {
+    return this->first;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::constPointer
+DataStructure::MonotonicArenaAllocator<T>::getCursor() const & noexcept {
+    return this->cursor;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer &
+DataStructure::MonotonicArenaAllocator<T>::getCursor() & noexcept {
+    return this->cursor;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::end() const & noexcept {
+    return this->first + static_cast<differenceType>(this->allocateSize);
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::resize(sizeType size) & {
+    if(size <= this->allocateSize) {
+        return this->first;
+    }
+    const auto oldSize {this->allocateSize};
+    this->allocateSize = size;
+    this->reallocate(oldSize);
+    return this->first;
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::shrinkToFit() & {
+    auto size {this->size()};
+    if(size == this->allocateSize) {
+        return this->first;
+    }
+    this->arena->extend(this->first, sizeof(valueType) * this->allocateSize, sizeof(valueType) * size);
+    this->allocateSize = size;
+    return this->first;
+}
+template <typename T>
+void DataStructure::MonotonicArenaAllocator<T>::swap(MonotonicArenaAllocator &rhs) noexcept {
+    using std::swap;
+    swap(this->allocateSize, rhs.allocateSize);
+    swap(this->first, rhs.first);
+    swap(this->cursor, rhs.cursor);
+    swap(this->arena, rhs.arena);
+}
+template <typename T>
+typename DataStructure::MonotonicArenaAllocator<T>::pointer
+DataStructure::MonotonicArenaAllocator<T>::clear() & noexcept(
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        ) {
+    if(this->empty()) {
+        return this->cursor;
+    }
+    MonotonicArenaAllocator::destroy(
+            this->first, this->cursor,
+            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+    );
+    this->cursor = this->first;
+    return this->cursor;
+}
+template <typename T>
+DataStructure::MonotonicArena &DataStructure::MonotonicArenaAllocator<T>::getArena() const & noexcept {
+    return *this->arena;
+}
+
+#endif //DATA_STRUCTURE_MONOTONIC_ARENA_ALLOCATOR_HPP
@@ -5,6 +5,8 @@
 #ifndef DATA_STRUCTURE_QUEUE_HPP
 #define DATA_STRUCTURE_QUEUE_HPP
 
+#include <atomic>
+#include <thread>
 #include "Deque.hpp"
 
 namespace DataStructure {
@@ -23,7 +25,7 @@ namespace DataStructure {
         using constReference = typename container::constReference;
         using pointer = typename container::pointer;
         using constPointer = typename container::constPointer;
-        using constPointerConstant = typename container::constPointerConstant;
+        using constPointerConstant = const constPointer;
         using rightValueReference = typename container::rightValueReference;
     private:
         container c;
@@ -54,6 +56,10 @@ namespace DataStructure {
         void
 #endif
         pop();
+        bool tryFront(reference) const;
+        bool tryPush(constReference);
+        bool tryPush(rightValueReference);
+        bool tryPop(reference);
         void swap(Queue &);
         void clear();
 #ifdef OTHER_FUNCTION
@@ -76,7 +82,7 @@ namespace DataStructure {
     public:
 #include <iostream>
         void print() const {
-            for(auto cursor {this->c}; cursor not_eq this->last;) {
+            for(auto cursor {this->first}; cursor not_eq this->last;) {
                 std::cout << *cursor++ << ", ";
             }
             std::cout << std::endl;
@@ -102,6 +108,7 @@ namespace DataStructure {
     private:
         sizeType containerSize;
         container c;
+        pointer first;
         pointer last;
     private:
         bool full() const;
@@ -133,6 +140,10 @@ namespace DataStructure {
         void
 #endif
         pop();
+        bool tryFront(reference) const;
+        bool tryPush(constReference);
+        bool tryPush(rightValueReference);
+        bool tryPop(reference);
         void clear();
         void swap(Queue &);
 #ifdef OTHER_FUNCTION
@@ -153,6 +164,9 @@ namespace DataStructure {
         pointer &getLast() {
             return this->last;
         }
+        pointer &getFirst() {
+            return this->first;
+        }
 #endif
     };
     template <typename T>
@@ -208,6 +222,10 @@ namespace DataStructure {
         void
 #endif
         pop();
+        bool tryFront(reference) const;
+        bool tryPush(constReference);
+        bool tryPush(rightValueReference);
+        bool tryPop(reference);
         void clear();
         void swap(Queue &);
 #ifdef OTHER_FUNCTION
@@ -287,6 +305,10 @@ namespace DataStructure {
         void
 #endif
         pop();
+        bool tryFront(reference) const;
+        bool tryPush(constReference);
+        bool tryPush(rightValueReference);
+        bool tryPop(reference);
         void clear();
         void swap(Queue &);
 #ifdef OTHER_FUNCTION
@@ -315,6 +337,123 @@ namespace DataStructure {
         }
 #endif
     };
+    struct SingleProducerSingleConsumer {};
+    template <typename T>
+    class Queue<T, SingleProducerSingleConsumer, true, false> final {
+    private:
+        using container = T *;
+    private:
+        class EmptyQueue;
+        class FullQueue;
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = T &;
+        using constReference = const T &;
+        using pointer = T *;
+        using constPointer = const T *;
+        using constPointerConstant = const T *const;
+        using rightValueReference = T &&;
+    public:
+        enum : sizeType {
+            cacheLineSize = 64
+        };
+    private:
+        const sizeType containerSize;
+        const container c;
+        alignas(cacheLineSize) std::atomic<sizeType> first;
+        sizeType cachedLast;
+        alignas(cacheLineSize) std::atomic<sizeType> last;
+        sizeType cachedFirst;
+        char padding[cacheLineSize - sizeof(std::atomic<sizeType>) - sizeof(sizeType)];
+    private:
+        sizeType next(sizeType) const noexcept;
+        sizeType vacancy(sizeType) noexcept;
+        sizeType occupancy(sizeType) noexcept;
+    public:
+        explicit Queue(sizeType = 64);
+        Queue(const Queue &) = delete;
+        Queue(Queue &&) noexcept = delete;
+        Queue &operator=(const Queue &) = delete;
+        Queue &operator=(Queue &&) noexcept = delete;
+        explicit operator bool() const noexcept;
+        ~Queue();
+    public:
+        bool full() const noexcept;
+        bool empty() const noexcept;
+        sizeType size() const noexcept;
+        sizeType capacity() const noexcept;
+        constReference front() const;
+        void push(constReference);
+        void push(rightValueReference);
+#ifdef POP_GET_OBJECT
+        valueType
+#else
+        void
+#endif
+        pop();
+        bool tryFront(reference) const;
+        bool tryPush(constReference);
+        bool tryPush(rightValueReference);
+        bool tryPop(reference);
+        sizeType tryPushN(constPointer, sizeType);
+        sizeType tryPopN(pointer, sizeType);
+    };
+    struct MultiProducerMultiConsumer {};
+    template <typename T>
+    class Queue<T, MultiProducerMultiConsumer, false, false> final {
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = T &;
+        using constReference = const T &;
+        using pointer = T *;
+        using constPointer = const T *;
+        using constPointerConstant = const T *const;
+        using rightValueReference = T &&;
+    public:
+        enum : sizeType {
+            cacheLineSize = 64
+        };
+    private:
+        struct cell {
+            std::atomic<sizeType> sequence;
+            alignas(valueType) unsigned char data[sizeof(valueType)];
+        };
+        using container = cell *;
+    private:
+        const sizeType mask;
+        const container c;
+        alignas(cacheLineSize) std::atomic<sizeType> first;
+        alignas(cacheLineSize) std::atomic<sizeType> last;
+        char padding[cacheLineSize - sizeof(std::atomic<sizeType>)];
+    private:
+        static sizeType roundUp(sizeType) noexcept;
+        static void wait(sizeType &) noexcept;
+        cell *acquirePush() noexcept;
+        cell *acquirePop() noexcept;
+    public:
+        explicit Queue(sizeType = 64);
+        Queue(const Queue &) = delete;
+        Queue(Queue &&) noexcept = delete;
+        Queue &operator=(const Queue &) = delete;
+        Queue &operator=(Queue &&) noexcept = delete;
+        explicit operator bool() const noexcept;
+        ~Queue();
+    public:
+        bool full() const noexcept;
+        bool empty() const noexcept;
+        sizeType size() const noexcept;
+        sizeType capacity() const noexcept;
+        bool tryPush(constReference);
+        bool tryPush(rightValueReference);
+        bool tryPop(reference);
+        void push(constReference);
+        void push(rightValueReference);
+        void pop(reference);
+    };
 }
 
 template <typename T, typename Container, bool sacrifice, bool tag>
@@ -366,12 +505,12 @@ DataStructure::Queue<T, Container, sacrifice, tag>::size() const {
 template <typename T, typename Container, bool sacrifice, bool tag>
 inline typename DataStructure::Queue<T, Container, sacrifice, tag>::constReference
 DataStructure::Queue<T, Container, sacrifice, tag>::back() const {
-    return this->c.back();
+    return *(this->c.end() - 1);
 }
 template <typename T, typename Container, bool sacrifice, bool tag>
 inline typename DataStructure::Queue<T, Container, sacrifice, tag>::constReference
 DataStructure::Queue<T, Container, sacrifice, tag>::front() const {
-    return this->c.front();
+    return *this->c.begin();
 }
 template <typename T, typename Container, bool sacrifice, bool tag>
 inline void DataStructure::Queue<T, Container, sacrifice, tag>::push(constReference value) {
@@ -395,6 +534,33 @@ DataStructure::Queue<T, Container, sacrifice, tag>::pop() {
     this->c.popFront();
 }
 template <typename T, typename Container, bool sacrifice, bool tag>
+inline bool DataStructure::Queue<T, Container, sacrifice, tag>::tryFront(reference value) const {
+    if(this->c.empty()) {
+        return false;
+    }
+    value = this->c.front();
+    return true;
+}
+template <typename T, typename Container, bool sacrifice, bool tag>
+inline bool DataStructure::Queue<T, Container, sacrifice, tag>::tryPush(constReference value) {
+    this->c.pushBack(value);
+    return true;
+}
+template <typename T, typename Container, bool sacrifice, bool tag>
+inline bool DataStructure::Queue<T, Container, sacrifice, tag>::tryPush(rightValueReference value) {
+    this->c.pushBack(std::move(value));
+    return true;
+}
+template <typename T, typename Container, bool sacrifice, bool tag>
+inline bool DataStructure::Queue<T, Container, sacrifice, tag>::tryPop(reference value) {
+    if(this->c.empty()) {
+        return false;
+    }
+    value = std::move(static_cast<rightValueReference>(this->c.front()));
+    this->c.popFront();
+    return true;
+}
+template <typename T, typename Container, bool sacrifice, bool tag>
 inline void DataStructure::Queue<T, Container, sacrifice, tag>::clear() {
     this->c.clear();
 }
@@ -443,33 +609,42 @@ inline bool DataStructure::Queue<T, T *, false, false>::full() const {
 template <typename T>
 inline void DataStructure::Queue<T, T *, false, false>::reallocate() {
     const auto size {this->size()};
-    this->containerSize *= 2;
+    if(static_cast<sizeType>(this->first - this->c) >= this->containerSize / 2 and this->first not_eq this->c) {
+        for(sizeType i {0}; i < size; ++i) {
+            new (this->c + i) valueType(std::move(static_cast<rightValueReference>(this->first[i])));
+            this->first[i].~valueType();
+        }
+        this->first = this->c;
+        this->last = this->c + size;
+        return;
+    }
+    this->containerSize = this->containerSize ? this->containerSize * 2 : 64;
     auto newContainer {reinterpret_cast<container>(::operator new (sizeof(valueType) * this->containerSize))};
-    for(auto i {0}; i < size; ++i) {
-        new (newContainer + i) valueType(std::move(static_cast<rightValueReference>(this->c[i])));
+    for(sizeType i {0}; i < size; ++i) {
+        new (newContainer + i) valueType(std::move(static_cast<rightValueReference>(this->first[i])));
     }
     this->clear();
     ::operator delete (this->c);
-    this->c = newContainer;
+    this->c = this->first = newContainer;
     this->last = this->c + size;
 }
 template <typename T>
 DataStructure::Queue<T, T *, false, false>::Queue(sizeType size) : containerSize {size},
         c {reinterpret_cast<container>(::operator new (sizeof(valueType) * this->containerSize))},
-        last {this->c} {}
+        first {this->c}, last {this->c} {}
 template <typename T>
 DataStructure::Queue<T, T *, false, false>::Queue(const Queue &other) : containerSize {other.containerSize},
         c {reinterpret_cast<container>(::operator new (sizeof(valueType) * this->containerSize))},
-        last {this->c} {
-    for(auto cursor {other.c}; cursor not_eq other.last;) {
+        first {this->c}, last {this->c} {
+    for(auto cursor {other.first}; cursor not_eq other.last;) {
         new (this->last++) valueType(*cursor++);
     }
 }
 template <typename T>
 DataStructure::Queue<T, T *, false, false>::Queue(Queue &&other) noexcept : containerSize {other.containerSize},
-        c {other.c}, last {other.last} {
+        c {other.c}, first {other.first}, last {other.last} {
     other.containerSize = 0;
-    other.c = other.last = nullptr;
+    other.c = other.first = other.last = nullptr;
 }
 template <typename T>
 DataStructure::Queue<T, T *, false, false>::~Queue() {
@@ -486,8 +661,8 @@ DataStructure::Queue<T, T *, false, false>::operator=(const Queue &other) {
     ::operator delete (this->c);
     this->containerSize = other.containerSize;
     this->c = reinterpret_cast<container>(::operator new (sizeof(valueType) * this->containerSize));
-    this->last = this->c;
-    for(auto cursor {other.c}; cursor not_eq other.last;) {
+    this->first = this->last = this->c;
+    for(auto cursor {other.first}; cursor not_eq other.last;) {
         new (this->last++) valueType(*cursor++);
     }
     return *this;
@@ -501,16 +676,17 @@ DataStructure::Queue<T, T *, false, false>::operator=(Queue &&other) noexcept {
     this->clear();
     ::operator delete (this->c);
     this->c = other.c;
+    this->first = other.first;
     this->last = other.last;
     this->containerSize = other.containerSize;
-    other.c = other.last = nullptr;
+    other.c = other.first = other.last = nullptr;
     other.containerSize = 0;
     return *this;
 }
 template <typename T>
 inline bool DataStructure::Queue<T, T *, false, false>::operator==(const Queue &other) const {
     return this->size() == other.size() and [&]() -> bool {
-        for(auto thisCursor {this->c}, otherCursor {other.c}; thisCursor not_eq this->last;) {
+        for(auto thisCursor {this->first}, otherCursor {other.first}; thisCursor not_eq this->last;) {
             if(*thisCursor++ not_eq *otherCursor++) {
                 return false;
             }
@@ -528,12 +704,12 @@ inline DataStructure::Queue<T, T *, false, false>::operator bool() const {
 }
 template <typename T>
 inline bool DataStructure::Queue<T, T *, false, false>::empty() const {
-    return this->c == this->last;
+    return this->first == this->last;
 }
 template <typename T>
 inline typename DataStructure::Queue<T, T *, false, false>::sizeType
 DataStructure::Queue<T, T *, false, false>::size() const {
-    return static_cast<sizeType>(this->last - this->c);
+    return static_cast<sizeType>(this->last - this->first);
 }
 template <typename T>
 typename DataStructure::Queue<T, T *, false, false>::constReference
@@ -541,7 +717,7 @@ DataStructure::Queue<T, T *, false, false>::front() const {
     if(this->empty()) {
         throw EmptyQueue("The queue is empty!");
     }
-    return *this->c;
+    return *this->first;
 }
 template <typename T>
 typename DataStructure::Queue<T, T *, false, false>::constReference
@@ -576,37 +752,59 @@ DataStructure::Queue<T, T *, false, false>::pop() {
         throw EmptyQueue("The queue is empty!");
     }
 #ifdef POP_GET_OBJECT
-    valueType temp {std::move(static_cast<rightValueReference>(*this->c))};
+    valueType temp {std::move(static_cast<rightValueReference>(*this->first))};
 #endif
-    auto size {this->size() - 1};
-    if(not size) {
-        (--this->last)->~valueType();
-#ifdef POP_GET_OBJECT
-        return temp;
-#else
-        return;
-#endif
-    }
-    for(auto i {0}; i < size; ++i) {
-        this->c[i].~valueType();
-        new (this->c + i) valueType(std::move(static_cast<rightValueReference>(this->c[i + 1])));
+    (this->first++)->~valueType();
+    if(this->first == this->last) {
+        this->first = this->last = this->c;
     }
-    (--this->last)->~valueType();
 #ifdef POP_GET_OBJECT
     return temp;
 #endif
 }
 template <typename T>
+bool DataStructure::Queue<T, T *, false, false>::tryFront(reference value) const {
+    if(this->empty()) {
+        return false;
+    }
+    value = *this->first;
+    return true;
+}
+template <typename T>
+inline bool DataStructure::Queue<T, T *, false, false>::tryPush(constReference value) {
+    this->push(value);
+    return true;
+}
+template <typename T>
+inline bool DataStructure::Queue<T, T *, false, false>::tryPush(rightValueReference value) {
+    this->push(std::move(value));
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, T *, false, false>::tryPop(reference value) {
+    if(this->empty()) {
+        return false;
+    }
+    value = std::move(static_cast<rightValueReference>(*this->first));
+    (this->first++)->~valueType();
+    if(this->first == this->last) {
+        this->first = this->last = this->c;
+    }
+    return true;
+}
+template <typename T>
 inline void DataStructure::Queue<T, T *, false, false>::clear() {
-    while(this->last-- not_eq this->c) {
-        this->last->~valueType();
+    while(this->last not_eq this->first) {
+        (--this->last)->~valueType();
     }
+    this->first = this->last = this->c;
 }
 template <typename T>
 void DataStructure::Queue<T, T *, false, false>::swap(Queue &other) {
     using std::swap;
     swap(this->c, other.c);
     swap(this->containerSize, other.containerSize);
+    swap(this->first, other.first);
     swap(this->last, other.last);
 }
 
@@ -740,23 +938,15 @@ DataStructure::Queue<T, T *, true, false>::back() const {
 }
 template <typename T>
 void DataStructure::Queue<T, T *, true, false>::push(constReference value) {
-    if(this->full()) {
+    if(not this->tryPush(value)) {
         throw FullQueue("The queue is full!");
     }
-    new (this->last++) valueType(value);
-    if(this->last == this->c + this->containerSize) {
-        this->last = this->c;
-    }
 }
 template <typename T>
 void DataStructure::Queue<T, T *, true, false>::push(rightValueReference value) {
-    if(this->full()) {
+    if(not this->tryPush(std::move(value))) {
         throw FullQueue("The queue is full!");
     }
-    new (this->last++) valueType(std::move(value));
-    if(this->last == this->c + this->containerSize) {
-        this->last = this->c;
-    }
 }
 template <typename T>
 #ifdef POP_GET_OBJECT
@@ -782,16 +972,58 @@ DataStructure::Queue<T, T *, true, false>::pop() {
 #endif
 }
 template <typename T>
+bool DataStructure::Queue<T, T *, true, false>::tryFront(reference value) const {
+    if(this->empty()) {
+        return false;
+    }
+    value = *this->first;
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, T *, true, false>::tryPush(constReference value) {
+    if(this->full()) {
+        return false;
+    }
+    new (this->last++) valueType(value);
+    if(this->last == this->c + this->containerSize) {
+        this->last = this->c;
+    }
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, T *, true, false>::tryPush(rightValueReference value) {
+    if(this->full()) {
+        return false;
+    }
+    new (this->last++) valueType(std::move(value));
+    if(this->last == this->c + this->containerSize) {
+        this->last = this->c;
+    }
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, T *, true, false>::tryPop(reference value) {
+    if(this->empty()) {
+        return false;
+    }
+    value = std::move(static_cast<rightValueReference>(*this->first));
+    this->first++->~valueType();
+    if(this->first == this->c + this->containerSize) {
+        this->first = this->c;
+    }
+    return true;
+}
+template <typename T>
 inline void DataStructure::Queue<T, T *, true, false>::clear() {
     if(this->empty()) {
         return;
     }
     auto last {this->c + this->containerSize};
     while(this->first not_eq this->last) {
+        this->first++->~valueType();
         if(this->first == last) {
             this->first = this->c;
         }
-        this->first++->~valueType();
     }
 }
 template <typename T>
@@ -926,29 +1158,15 @@ DataStructure::Queue<T, T *, false, true>::back() const {
 }
 template <typename T>
 void DataStructure::Queue<T, T *, false, true>::push(constReference value) {
-    if(this->full()) {
+    if(not this->tryPush(value)) {
         throw FullQueue("The queue is full!");
     }
-    new (this->last++) valueType(value);
-    if(this->last == this->c + this->containerSize) {
-        this->last = this->c;
-    }
-    if(this->last == this->first) {
-        this->tag = true;
-    }
 }
 template <typename T>
 void DataStructure::Queue<T, T *, false, true>::push(rightValueReference value) {
-    if(this->full()) {
+    if(not this->tryPush(std::move(value))) {
         throw FullQueue("The queue is full!");
     }
-    new (this->last++) valueType(std::move(value));
-    if(this->last == this->c + this->containerSize) {
-        this->last = this->c;
-    }
-    if(this->last == this->first) {
-        this->tag = true;
-    }
 }
 template <typename T>
 #ifdef POP_GET_OBJECT
@@ -973,6 +1191,55 @@ DataStructure::Queue<T, T *, false, true>::pop() {
 #endif
 }
 template <typename T>
+bool DataStructure::Queue<T, T *, false, true>::tryFront(reference value) const {
+    if(this->empty()) {
+        return false;
+    }
+    value = *this->first;
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, T *, false, true>::tryPush(constReference value) {
+    if(this->full()) {
+        return false;
+    }
+    new (this->last++) valueType(value);
+    if(this->last == this->c + this->containerSize) {
+        this->last = this->c;
+    }
+    if(this->last == this->first) {
+        this->tag = true;
+    }
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, T *, false, true>::tryPush(rightValueReference value) {
+    if(this->full()) {
+        return false;
+    }
+    new (this->last++) valueType(std::move(value));
+    if(this->last == this->c + this->containerSize) {
+        this->last = this->c;
+    }
+    if(this->last == this->first) {
+        this->tag = true;
+    }
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, T *, false, true>::tryPop(reference value) {
+    if(this->empty()) {
+        return false;
+    }
+    value = std::move(static_cast<rightValueReference>(*this->first));
+    this->first++->~valueType();
+    if(this->first == this->c + this->containerSize) {
+        this->first = this->c;
+    }
+    this->tag = false;
+    return true;
+}
+template <typename T>
 inline void DataStructure::Queue<T, T *, false, true>::clear() {
     if(this->empty()) {
         return;
@@ -996,6 +1263,351 @@ void DataStructure::Queue<T, T *, false, true>::swap(Queue &other) {
     swap(this->tag, other.tag);
 }
 
+template <typename T>
+class DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::EmptyQueue :
+        public DataStructure::RuntimeException {
+public:
+    explicit EmptyQueue(const char *error) : RuntimeException(error) {}
+    explicit EmptyQueue(const std::string &error) : RuntimeException(error) {}
+};
+template <typename T>
+class DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::FullQueue :
+        public DataStructure::RuntimeException {
+public:
+    explicit FullQueue(const char *error) : RuntimeException(error) {}
+    explicit FullQueue(const std::string &error) : RuntimeException(error) {}
+};
+
+template <typename T>
+inline typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::sizeType
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::next(sizeType index) const noexcept {
+    return ++index == this->containerSize ? 0 : index;
+}
+template <typename T>
+inline typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::sizeType
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::vacancy(sizeType last) noexcept {
+    auto vacancy {(this->cachedFirst + this->containerSize - last - 1) % this->containerSize};
+    if(not vacancy) {
+        this->cachedFirst = this->first.load(std::memory_order_acquire);
+        vacancy = (this->cachedFirst + this->containerSize - last - 1) % this->containerSize;
+    }
+    return vacancy;
+}
+template <typename T>
+inline typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::sizeType
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::occupancy(sizeType first) noexcept {
+    auto occupancy {(this->cachedLast + this->containerSize - first) % this->containerSize};
+    if(not occupancy) {
+        this->cachedLast = this->last.load(std::memory_order_acquire);
+        occupancy = (this->cachedLast + this->containerSize - first) % this->containerSize;
+    }
+    return occupancy;
+}
+template <typename T>
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::Queue(sizeType size) :
+        containerSize {size + 1},
+        c {reinterpret_cast<container>(::operator new (sizeof(valueType) * this->containerSize))},
+        first {0}, cachedLast {0}, last {0}, cachedFirst {0}, padding {} {}
+template <typename T>
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::~Queue() {
+    const auto last {this->last.load(std::memory_order_acquire)};
+    for(auto first {this->first.load(std::memory_order_relaxed)}; first not_eq last; first = this->next(first)) {
+        this->c[first].~valueType();
+    }
+    ::operator delete (this->c);
+}
+template <typename T>
+inline DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::operator bool() const noexcept {
+    return not this->empty();
+}
+template <typename T>
+inline bool DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::full() const noexcept {
+    return this->next(this->last.load(std::memory_order_acquire)) == this->first.load(std::memory_order_acquire);
+}
+template <typename T>
+inline bool DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::empty() const noexcept {
+    return this->first.load(std::memory_order_acquire) == this->last.load(std::memory_order_acquire);
+}
+template <typename T>
+inline typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::sizeType
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::size() const noexcept {
+    const auto first {this->first.load(std::memory_order_acquire)};
+    const auto last {this->last.load(std::memory_order_acquire)};
+    return (last + this->containerSize - first) % this->containerSize;
+}
+template <typename T>
+inline typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::sizeType
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::capacity() const noexcept {
+    return this->containerSize - 1;
+}
+template <typename T>
+typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::constReference
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::front() const {
+    if(this->empty()) {
+        throw EmptyQueue("The queue is empty!");
+    }
+    return this->c[this->first.load(std::memory_order_relaxed)];
+}
+template <typename T>
+void DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::push(constReference value) {
+    if(not this->tryPush(value)) {
+        throw FullQueue("The queue is full!");
+    }
+}
+template <typename T>
+void DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::push(rightValueReference value) {
+    if(not this->tryPush(std::move(value))) {
+        throw FullQueue("The queue is full!");
+    }
+}
+template <typename T>
+#ifdef POP_GET_OBJECT
+typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::valueType
+#else
+void
+#endif
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::pop() {
+    const auto first {this->first.load(std::memory_order_relaxed)};
+    if(not this->occupancy(first)) {
+        throw EmptyQueue("The queue is empty!");
+    }
+#ifdef POP_GET_OBJECT
+    auto temp {std::move(static_cast<rightValueReference>(this->c[first]))};
+#endif
+    this->c[first].~valueType();
+    this->first.store(this->next(first), std::memory_order_release);
+#ifdef POP_GET_OBJECT
+    return temp;
+#endif
+}
+template <typename T>
+bool DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::tryFront(
+        reference value) const {
+    const auto first {this->first.load(std::memory_order_relaxed)};
+    if(first == this->last.load(std::memory_order_acquire)) {
+        return false;
+    }
+    value = this->c[first];
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::tryPush(constReference value) {
+    const auto last {this->last.load(std::memory_order_relaxed)};
+    if(not this->vacancy(last)) {
+        return false;
+    }
+    new (this->c + last) valueType(value);
+    this->last.store(this->next(last), std::memory_order_release);
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::tryPush(
+        rightValueReference value) {
+    const auto last {this->last.load(std::memory_order_relaxed)};
+    if(not this->vacancy(last)) {
+        return false;
+    }
+    new (this->c + last) valueType(std::move(value));
+    this->last.store(this->next(last), std::memory_order_release);
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::tryPop(reference value) {
+    const auto first {this->first.load(std::memory_order_relaxed)};
+    if(not this->occupancy(first)) {
+        return false;
+    }
+    value = std::move(static_cast<rightValueReference>(this->c[first]));
+    this->c[first].~valueType();
+    this->first.store(this->next(first), std::memory_order_release);
+    return true;
+}
+template <typename T>
+typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::sizeType
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::tryPushN(
+        constPointer values, sizeType size) {
+    auto last {this->last.load(std::memory_order_relaxed)};
+    auto vacancy {this->vacancy(last)};
+    if(vacancy < size) {
+        this->cachedFirst = this->first.load(std::memory_order_acquire);
+        vacancy = (this->cachedFirst + this->containerSize - last - 1) % this->containerSize;
+    }
+    const auto count {vacancy < size ? vacancy : size};
+    for(auto i {static_cast<sizeType>(0)}; i < count; ++i) {
+        new (this->c + last) valueType(*values++);
+        last = this->next(last);
+    }
+    this->last.store(last, std::memory_order_release);
+    return count;
+}
+template <typename T>
+typename DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::sizeType
+DataStructure::Queue<T, DataStructure::SingleProducerSingleConsumer, true, false>::tryPopN(
+        pointer values, sizeType size) {
+    auto first {this->first.load(std::memory_order_relaxed)};
+    auto occupancy {this->occupancy(first)};
+    if(occupancy < size) {
+        this->cachedLast = this->last.load(std::memory_order_acquire);
+        occupancy = (this->cachedLast + this->containerSize - first) % this->containerSize;
+    }
+    const auto count {occupancy < size ? occupancy : size};
+    for(auto i {static_cast<sizeType>(0)}; i < count; ++i) {
+        *values++ = std::move(static_cast<rightValueReference>(this->c[first]));
+        this->c[first].~valueType();
+        first = this->next(first);
+    }
+    this->first.store(first, std::memory_order_release);
+    return count;
+}
+
+template <typename T>
+typename DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::sizeType
+DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::roundUp(sizeType size) noexcept {
+    sizeType result {1};
+    while(result < size) {
+        result <<= 1;
+    }
+    return result;
+}
+template <typename T>
+inline void DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::wait(sizeType &count) noexcept {
+    if(++count < 64) {
+        return;
+    }
+    std::this_thread::yield();
+}
+template <typename T>
+typename DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::cell *
+DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::acquirePush() noexcept {
+    auto last {this->last.load(std::memory_order_relaxed)};
+    while(true) {
+        auto target {this->c + (last & this->mask)};
+        const auto difference {
+            static_cast<differenceType>(target->sequence.load(std::memory_order_acquire)) -
+            static_cast<differenceType>(last)
+        };
+        if(not difference) {
+            if(this->last.compare_exchange_weak(last, last + 1, std::memory_order_relaxed)) {
+                return target;
+            }
+        }else if(difference < 0) {
+            return nullptr;
+        }else {
+            last = this->last.load(std::memory_order_relaxed);
+        }
+    }
+}
+template <typename T>
+typename DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::cell *
+DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::acquirePop() noexcept {
+    auto first {this->first.load(std::memory_order_relaxed)};
+    while(true) {
+        auto target {this->c + (first & this->mask)};
+        const auto difference {
+            static_cast<differenceType>(target->sequence.load(std::memory_order_acquire)) -
+            static_cast<differenceType>(first + 1)
+        };
+        if(not difference) {
+            if(this->first.compare_exchange_weak(first, first + 1, std::memory_order_relaxed)) {
+                return target;
+            }
+        }else if(difference < 0) {
+            return nullptr;
+        }else {
+            first = this->first.load(std::memory_order_relaxed);
+        }
+    }
+}
+template <typename T>
+DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::Queue(sizeType size) :
+        mask {Queue::roundUp(size ? size : 1) - 1},
+        c {reinterpret_cast<container>(::operator new (sizeof(cell) * (this->mask + 1)))},
+        first {0}, last {0}, padding {} {
+    for(auto i {static_cast<sizeType>(0)}; i <= this->mask; ++i) {
+        new (&this->c[i].sequence) std::atomic<sizeType>(i);
+    }
+}
+template <typename T>
+DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::~Queue() {
+    const auto last {this->last.load(std::memory_order_acquire)};
+    for(auto first {this->first.load(std::memory_order_relaxed)}; first not_eq last; ++first) {
+        reinterpret_cast<pointer>(this->c[first & this->mask].data)->~valueType();
+    }
+    ::operator delete (this->c);
+}
+template <typename T>
+inline DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::operator bool() const noexcept {
+    return not this->empty();
+}
+template <typename T>
+inline bool DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::full() const noexcept {
+    return this->size() > this->mask;
+}
+template <typename T>
+inline bool DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::empty() const noexcept {
+    return not this->size();
+}
+template <typename T>
+inline typename DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::sizeType
+DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::size() const noexcept {
+    const auto first {this->first.load(std::memory_order_acquire)};
+    const auto last {this->last.load(std::memory_order_acquire)};
+    return last > first ? last - first : 0;
+}
+template <typename T>
+inline typename DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::sizeType
+DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::capacity() const noexcept {
+    return this->mask + 1;
+}
+template <typename T>
+bool DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::tryPush(constReference value) {
+    valueType temp {value};
+    return this->tryPush(std::move(temp));
+}
+template <typename T>
+bool DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::tryPush(rightValueReference value) {
+    auto target {this->acquirePush()};
+    if(not target) {
+        return false;
+    }
+    new (target->data) valueType(std::move(value));
+    target->sequence.store(target->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+}
+template <typename T>
+bool DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::tryPop(reference value) {
+    auto target {this->acquirePop()};
+    if(not target) {
+        return false;
+    }
+    auto element {reinterpret_cast<pointer>(target->data)};
+    value = std::move(static_cast<rightValueReference>(*element));
+    element->~valueType();
+    target->sequence.store(
+            target->sequence.load(std::memory_order_relaxed) + this->mask, std::memory_order_release
+    );
+    return true;
+}
+template <typename T>
+void DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::push(constReference value) {
+    valueType temp {value};
+    for(sizeType count {0}; not this->tryPush(std::move(temp));) {
+        Queue::wait(count);
+    }
+}
+template <typename T>
+void DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::push(rightValueReference value) {
+    for(sizeType count {0}; not this->tryPush(std::move(value));) {
+        Queue::wait(count);
+    }
+}
+template <typename T>
+void DataStructure::Queue<T, DataStructure::MultiProducerMultiConsumer, false, false>::pop(reference value) {
+    for(sizeType count {0}; not this->tryPop(value);) {
+        Queue::wait(count);
+    }
+}
+
 #ifdef OTHER_FUNCTION
 template <typename T, typename Container, bool Sacrifice, bool Tag>
 inline void DataStructure::Queue<T, Container, Sacrifice, Tag>::resize(sizeType size) {
@@ -1023,13 +1635,13 @@ void DataStructure::Queue<T, T *, false, false>::resize(sizeType size) {
     }
     auto newContainer {reinterpret_cast<container>(::operator new (sizeof(valueType) * size))};
     const auto exists {this->size()};
-    for(auto i {0}; i < exists; ++i) {
-        new (newContainer + i) valueType(std::move(static_cast<rightValueReference>(this->c[i])));
+    for(sizeType i {0}; i < exists; ++i) {
+        new (newContainer + i) valueType(std::move(static_cast<rightValueReference>(this->first[i])));
     }
     this->clear();
     ::operator delete (this->c);
     this->last = newContainer + static_cast<differenceType>(exists);
-    this->c = newContainer;
+    this->c = this->first = newContainer;
     this->containerSize = size;
 }
 template <typename T>
@@ -1039,13 +1651,13 @@ void DataStructure::Queue<T, T *, false, false>::shrinkToFit() {
         return;
     }
     auto newContainer {reinterpret_cast<container>(::operator new (sizeof(valueType) * size))};
-    for(auto i {0}; i < size; ++i) {
-        new (newContainer + 1) valueType(std::move(static_cast<rightValueReference>(this->c[i])));
+    for(sizeType i {0}; i < size; ++i) {
+        new (newContainer + i) valueType(std::move(static_cast<rightValueReference>(this->first[i])));
     }
     this->clear();
     ::operator delete (this->c);
     this->last = newContainer + static_cast<differenceType>(size);
-    this->c = newContainer;
+    this->c = this->first = newContainer;
     this->containerSize = size;
 }
 template <typename T>
@@ -15,12 +15,12 @@ namespace DataStructure {
         using sizeType = typename container::sizeType;
         using differenceType = typename container::differenceType;
         using valueType = typename container::valueType;
-        using constType = typename container::constType;
+        using constType = const valueType;
         using reference = typename container::reference;
         using constReference = typename container::constReference;
         using pointer = typename container::pointer;
         using constPointer = typename container::constPointer;
-        using constPointerConstant = typename container::constPointerConstant;
+        using constPointerConstant = const constPointer;
         using rightValueReference = typename container::rightValueReference;
     protected:
         container c;
@@ -50,6 +50,10 @@ namespace DataStructure {
         void
 #endif
         pop();
+        bool tryTop(reference) const;
+        bool tryPush(constReference);
+        bool tryPush(rightValueReference);
+        bool tryPop(reference);
         void clear();
         void swap(Stack &);
 #ifdef OTHER_FUNCTION
@@ -125,6 +129,10 @@ public:
     void
 #endif
     pop();
+    bool tryTop(reference) const;
+    bool tryPush(constReference);
+    bool tryPush(rightValueReference);
+    bool tryPop(reference);
     void clear();
     void swap(Stack &);
 #ifdef OTHER_FUNCTION
@@ -215,6 +223,14 @@ public:
     void
 #endif
     popBack();
+    bool tryTopFront(reference) const;
+    bool tryTopBack(reference) const;
+    bool tryPushFront(constReference);
+    bool tryPushFront(rightValueReference);
+    bool tryPushBack(constReference);
+    bool tryPushBack(rightValueReference);
+    bool tryPopFront(reference);
+    bool tryPopBack(reference);
     void clear();
     void frontClear();
     void backClear();
@@ -285,7 +301,7 @@ DataStructure::Stack<T, Container, Bilateral>::size() const {
 template <typename T, typename Container, bool Bilateral>
 inline typename DataStructure::Stack<T, Container, Bilateral>::constReference
 DataStructure::Stack<T, Container, Bilateral>::top() const {
-    return this->c.back();
+    return *(this->c.end() - 1);
 }
 template <typename T, typename Container, bool Bilateral>
 inline void DataStructure::Stack<T, Container, Bilateral>::push(constReference value) {
@@ -310,6 +326,33 @@ DataStructure::Stack<T, Container, Bilateral>::pop() {
 #endif
 }
 template <typename T, typename Container, bool Bilateral>
+inline bool DataStructure::Stack<T, Container, Bilateral>::tryTop(reference value) const {
+    if(this->c.empty()) {
+        return false;
+    }
+    value = this->c.back();
+    return true;
+}
+template <typename T, typename Container, bool Bilateral>
+inline bool DataStructure::Stack<T, Container, Bilateral>::tryPush(constReference value) {
+    this->c.pushBack(value);
+    return true;
+}
+template <typename T, typename Container, bool Bilateral>
+inline bool DataStructure::Stack<T, Container, Bilateral>::tryPush(rightValueReference value) {
+    this->c.pushBack(std::move(value));
+    return true;
+}
+template <typename T, typename Container, bool Bilateral>
+inline bool DataStructure::Stack<T, Container, Bilateral>::tryPop(reference value) {
+    if(this->c.empty()) {
+        return false;
+    }
+    value = std::move(static_cast<rightValueReference>(this->c.back()));
+    this->c.popBack();
+    return true;
+}
+template <typename T, typename Container, bool Bilateral>
 inline void DataStructure::Stack<T, Container, Bilateral>::clear() {
     this->c.clear();
 }
@@ -386,7 +429,8 @@ DataStructure::Stack<T, T *, false>::Stack(Stack &&other) noexcept :
 }
 template <typename T>
 DataStructure::Stack<T, T *, false>::~Stack() {
-    delete[] this->c;
+    this->clear();
+    ::operator delete (this->c);
 }
 template <typename T>
 DataStructure::Stack<T, T *, false> &
@@ -394,7 +438,8 @@ DataStructure::Stack<T, T *, false>::operator=(const Stack &other) {
     if(&other == this) {
         return *this;
     }
-    delete[] this->c;
+    this->clear();
+    ::operator delete (this->c);
     this->containerSize = other.containerSize;
     this->c = reinterpret_cast<container>(::operator new (sizeof(valueType) * this->containerSize));
     this->last = this->c;
@@ -409,7 +454,8 @@ DataStructure::Stack<T, T *, false>::operator=(Stack &&other) noexcept {
     if(&other == this) {
         return *this;
     }
-    delete[] this->c;
+    this->clear();
+    ::operator delete (this->c);
     this->c = other.c;
     this->containerSize = other.containerSize;
     this->last = other.last;
@@ -515,11 +561,38 @@ DataStructure::Stack<T, T *, false>::pop() {
 #endif
 }
 template <typename T>
-void DataStructure::Stack<T, T *, false>::clear() {
-    while(--this->last not_eq this->c) {
-        this->last->~valueType();
+bool DataStructure::Stack<T, T *, false>::tryTop(reference value) const {
+    if(this->empty()) {
+        return false;
+    }
+    value = *(this->last - 1);
+    return true;
+}
+template <typename T>
+inline bool DataStructure::Stack<T, T *, false>::tryPush(constReference value) {
+    this->push(value);
+    return true;
+}
+template <typename T>
+inline bool DataStructure::Stack<T, T *, false>::tryPush(rightValueReference value) {
+    this->push(std::move(value));
+    return true;
+}
+template <typename T>
+bool DataStructure::Stack<T, T *, false>::tryPop(reference value) {
+    if(this->empty()) {
+        return false;
     }
+    --this->last;
+    value = std::move(static_cast<rightValueReference>(*this->last));
     this->last->~valueType();
+    return true;
+}
+template <typename T>
+void DataStructure::Stack<T, T *, false>::clear() {
+    while(this->last not_eq this->c) {
+        (--this->last)->~valueType();
+    }
 }
 template <typename T>
 void DataStructure::Stack<T, T *, false>::swap(Stack &other) {
@@ -595,7 +668,8 @@ DataStructure::Stack<T, T *, true>::Stack(Stack &&other) noexcept : containerSiz
 }
 template <typename T>
 DataStructure::Stack<T, T *, true>::~Stack() {
-    delete[] this->c;
+    this->clear();
+    ::operator delete (this->c);
 }
 template <typename T>
 DataStructure::Stack<T, T *, true> &
@@ -603,7 +677,8 @@ DataStructure::Stack<T, T *, true>::operator=(const Stack &other) {
     if(&other == this) {
         return *this;
     }
-    delete[] this->c;
+    this->clear();
+    ::operator delete (this->c);
     this->containerSize = other.containerSize;
     this->c = reinterpret_cast<container>(::operator new (sizeof(valueType) * this->containerSize));
     this->leftLast = this->c;
@@ -622,7 +697,8 @@ DataStructure::Stack<T, T *, true>::operator=(Stack &&other) noexcept {
     if(&other == this) {
         return *this;
     }
-    delete[] this->c;
+    this->clear();
+    ::operator delete (this->c);
     this->containerSize = other.containerSize;
     this->c = other.c;
     this->leftLast = other.leftLast;
@@ -751,19 +827,73 @@ DataStructure::Stack<T, T *, true>::popBack() {
 #endif
 }
 template <typename T>
-inline void DataStructure::Stack<T, T *, true>::frontClear() {
-    while(--this->leftLast not_eq this->c) {
-        this->leftLast->~valueType();
+bool DataStructure::Stack<T, T *, true>::tryTopFront(reference value) const {
+    if(this->frontEmpty()) {
+        return false;
+    }
+    value = *(this->leftLast - 1);
+    return true;
+}
+template <typename T>
+bool DataStructure::Stack<T, T *, true>::tryTopBack(reference value) const {
+    if(this->backEmpty()) {
+        return false;
+    }
+    value = *(this->rightLast + 1);
+    return true;
+}
+template <typename T>
+inline bool DataStructure::Stack<T, T *, true>::tryPushFront(constReference value) {
+    this->pushFront(value);
+    return true;
+}
+template <typename T>
+inline bool DataStructure::Stack<T, T *, true>::tryPushFront(rightValueReference value) {
+    this->pushFront(std::move(value));
+    return true;
+}
+template <typename T>
+inline bool DataStructure::Stack<T, T *, true>::tryPushBack(constReference value) {
+    this->pushBack(value);
+    return true;
+}
+template <typename T>
+inline bool DataStructure::Stack<T, T *, true>::tryPushBack(rightValueReference value) {
+    this->pushBack(std::move(value));
+    return true;
+}
+template <typename T>
+bool DataStructure::Stack<T, T *, true>::tryPopFront(reference value) {
+    if(this->frontEmpty()) {
+        return false;
     }
+    --this->leftLast;
+    value = std::move(static_cast<rightValueReference>(*this->leftLast));
     this->leftLast->~valueType();
+    return true;
+}
+template <typename T>
+bool DataStructure::Stack<T, T *, true>::tryPopBack(reference value) {
+    if(this->backEmpty()) {
+        return false;
+    }
+    ++this->rightLast;
+    value = std::move(static_cast<rightValueReference>(*this->rightLast));
+    this->rightLast->~valueType();
+    return true;
+}
+template <typename T>
+inline void DataStructure::Stack<T, T *, true>::frontClear() {
+    while(this->leftLast not_eq this->c) {
+        (--this->leftLast)->~valueType();
+    }
 }
 template <typename T>
 inline void DataStructure::Stack<T, T *, true>::backClear() {
     auto last {this->c + (this->containerSize - 1)};
-    while(++this->rightLast not_eq last) {
-        this->rightLast->~valueType();
+    while(this->rightLast not_eq last) {
+        (++this->rightLast)->~valueType();
     }
-    this->rightLast->~valueType();
 }
 template <typename T>
 void DataStructure::Stack<T, T *, true>::clear() {
@@ -917,8 +1047,9 @@ void DataStructure::Stack<T, T *, false>::shrinkToFit() {
     };
     for(auto i {0}; i < this->containerSize; ++i) {
         new (newContainer + i) valueType(std::move(static_cast<rightValueReference>(this->c[i])));
+        this->c[i].~valueType();
     }
-    delete[] this->c;
+    ::operator delete (this->c);
     this->c = newContainer;
     this->last = this->c + this->containerSize;
 }
@@ -947,16 +1078,18 @@ void DataStructure::Stack<T, T *, true>::shrinkToFit() {
     auto cursor {this->c};
     auto moveCursor {newContainer};
     while(cursor not_eq this->leftLast) {
-        new (moveCursor++) valueType(std::move(static_cast<rightValueReference>(*cursor++)));
+        new (moveCursor++) valueType(std::move(static_cast<rightValueReference>(*cursor)));
+        cursor++->~valueType();
     }
     this->leftLast = moveCursor;
     moveCursor = newContainer + (size - 1);
     cursor = this->c + (this->containerSize - 1);
     while(cursor not_eq this->rightLast) {
-        new (moveCursor--) valueType(std::move(static_cast<rightValueReference>(*cursor--)));
+        new (moveCursor--) valueType(std::move(static_cast<rightValueReference>(*cursor)));
+        cursor--->~valueType();
     }
     this->rightLast = moveCursor;
-    delete[] this->c;
+    ::operator delete (this->c);
     this->c = newContainer;
     this->containerSize = size;
 }
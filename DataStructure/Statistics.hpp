@@ -0,0 +1,89 @@
+#ifndef DATA_STRUCTURE_STATISTICS_HPP
+#define DATA_STRUCTURE_STATISTICS_HPP
+
+#include <atomic>
+#include <type_traits>
+
+namespace DataStructure {
+    enum class StatisticsEvent : unsigned {
+        ALLOCATE, REALLOCATE, CONSTRUCT, DESTROY, ADD_BUFFER, COPY, MOVE, EVENT_NUMBER
+    };
+    struct StatisticsSnapshot {
+        unsigned long allocate;
+        unsigned long reallocate;
+        unsigned long construct;
+        unsigned long destroy;
+        unsigned long addBuffer;
+        unsigned long copy;
+        unsigned long move;
+    };
+    template <typename Type>
+    class Statistics final {
+    public:
+        using sizeType = unsigned long;
+    private:
+        static std::atomic<sizeType> counters[static_cast<unsigned>(StatisticsEvent::EVENT_NUMBER)];
+    public:
+        Statistics() = delete;
+    public:
+        static void count(StatisticsEvent, sizeType = 1) noexcept;
+        template <typename Argument>
+        static void construct(sizeType = 1) noexcept;
+        static sizeType get(StatisticsEvent) noexcept;
+        static StatisticsSnapshot snapshot() noexcept;
+        static void reset() noexcept;
+    };
+}
+
+#ifdef STATISTICS_DATA_STRUCTURE
+#define __DATA_STRUCTURE_STATISTICS_COUNT(Type, event) \
+        DataStructure::Statistics<Type>::count(DataStructure::StatisticsEvent::event)
+#define __DATA_STRUCTURE_STATISTICS_COUNT_N(Type, event, number) \
+        DataStructure::Statistics<Type>::count( \
+                DataStructure::StatisticsEvent::event, static_cast<unsigned long>(number) \
+        )
+#define __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Type, Argument) \
+        DataStructure::Statistics<Type>::template construct<Argument>()
+#define __DATA_STRUCTURE_STATISTICS_CONSTRUCT_N(Type, Argument, number) \
+        DataStructure::Statistics<Type>::template construct<Argument>(static_cast<unsigned long>(number))
+#else
+#define __DATA_STRUCTURE_STATISTICS_COUNT(Type, event) static_cast<void>(0)
+#define __DATA_STRUCTURE_STATISTICS_COUNT_N(Type, event, number) static_cast<void>(0)
+#define __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Type, Argument) static_cast<void>(0)
+#define __DATA_STRUCTURE_STATISTICS_CONSTRUCT_N(Type, Argument, number) static_cast<void>(0)
+#endif
+
+template <typename Type>
+std::atomic<typename DataStructure::Statistics<Type>::sizeType>
+DataStructure::Statistics<Type>::counters[static_cast<unsigned>(StatisticsEvent::EVENT_NUMBER)] {};
+template <typename Type>
+inline void DataStructure::Statistics<Type>::count(StatisticsEvent event, sizeType number) noexcept {
+    counters[static_cast<unsigned>(event)].fetch_add(number, std::memory_order_relaxed);
+}
+template <typename Type>
+template <typename Argument>
+inline void DataStructure::Statistics<Type>::construct(sizeType number) noexcept {
+    count(StatisticsEvent::CONSTRUCT, number);
+    count(std::is_lvalue_reference<Argument>::value ? StatisticsEvent::COPY : StatisticsEvent::MOVE, number);
+}
+template <typename Type>
+inline typename DataStructure::Statistics<Type>::sizeType
+DataStructure::Statistics<Type>::get(StatisticsEvent event) noexcept {
+    return counters[static_cast<unsigned>(event)].load(std::memory_order_relaxed);
+}
+template <typename Type>
+DataStructure::StatisticsSnapshot DataStructure::Statistics<Type>::snapshot() noexcept {
+    return StatisticsSnapshot {
+        get(StatisticsEvent::ALLOCATE), get(StatisticsEvent::REALLOCATE), get(StatisticsEvent::CONSTRUCT),
+        get(StatisticsEvent::DESTROY), get(StatisticsEvent::ADD_BUFFER), get(StatisticsEvent::COPY),
+        get(StatisticsEvent::MOVE)
+    };
+}
+template <typename Type>
+void DataStructure::Statistics<Type>::reset() noexcept {
+    for(auto &counter : counters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+#endif //DATA_STRUCTURE_STATISTICS_HPP
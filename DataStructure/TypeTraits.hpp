@@ -1,6 +1,8 @@
 #ifndef DATA_STRUCTURE_TYPETRAITS_HPP
 #define DATA_STRUCTURE_TYPETRAITS_HPP
 
+#include <type_traits>
+
 namespace DataStructure {
     struct __DataStructure_trueType {
         constexpr bool operator()() const noexcept {
@@ -202,195 +204,43 @@ namespace DataStructure {
         constexpr static bool isBidirectionalIterator {BidirectionalIterator::isBidirectionalIterator};
         constexpr static bool isRandomAccessIterator {true};
     };
-    template <typename T>
-    struct __DataStructure_TypeTraits {
-        using hasTrivialDefaultConstructor = __DataStructure_falseType;
-        using hasTrivialCopyConstructor = __DataStructure_falseType;
-        using hasTrivialMoveConstructor = __DataStructure_falseType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_falseType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_falseType;
-        using hasTrivialDestructor = __DataStructure_falseType;
-        using is_POD_type = __DataStructure_falseType;
-    };
-    template <typename T>
-    struct __DataStructure_TypeTraits<T *> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<int> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<unsigned int> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<short int> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<unsigned short int> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<char> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<signed char> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<unsigned char> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<char16_t> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<char32_t> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<wchar_t> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<long int> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<unsigned long int> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<long long int> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
-    };
-    template <>
-    struct __DataStructure_TypeTraits<unsigned long long int> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
+    template <bool>
+    struct __DataStructure_BooleanType {
+        using __result = __DataStructure_falseType;
     };
     template <>
-    struct __DataStructure_TypeTraits<float> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
+    struct __DataStructure_BooleanType<true> {
+        using __result = __DataStructure_trueType;
     };
-    template <>
-    struct __DataStructure_TypeTraits<double> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
+    template <typename T>
+    struct IsTriviallyRelocatable {
+        using result = __DataStructure_falseType;
     };
-    template <>
-    struct __DataStructure_TypeTraits<long double> {
-        using hasTrivialDefaultConstructor = __DataStructure_trueType;
-        using hasTrivialCopyConstructor = __DataStructure_trueType;
-        using hasTrivialMoveConstructor = __DataStructure_trueType;
-        using hasTrivialCopyAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialMoveAssignmentOperator = __DataStructure_trueType;
-        using hasTrivialDestructor = __DataStructure_trueType;
-        using is_POD_type = __DataStructure_trueType;
+    template <typename T>
+    struct __DataStructure_TypeTraits {
+        using hasTrivialDefaultConstructor = typename __DataStructure_BooleanType<
+                std::is_trivially_default_constructible<T>::value
+        >::__result;
+        using hasTrivialCopyConstructor = typename __DataStructure_BooleanType<
+                std::is_trivially_copy_constructible<T>::value
+        >::__result;
+        using hasTrivialMoveConstructor = typename __DataStructure_BooleanType<
+                std::is_trivially_move_constructible<T>::value
+        >::__result;
+        using hasTrivialCopyAssignmentOperator = typename __DataStructure_BooleanType<
+                std::is_trivially_copy_assignable<T>::value
+        >::__result;
+        using hasTrivialMoveAssignmentOperator = typename __DataStructure_BooleanType<
+                std::is_trivially_move_assignable<T>::value
+        >::__result;
+        using hasTrivialDestructor = typename __DataStructure_BooleanType<
+                std::is_trivially_destructible<T>::value
+        >::__result;
+        using isTriviallyRelocatable = typename __DataStructure_BooleanType<
+                (std::is_trivially_move_constructible<T>::value and std::is_trivially_destructible<T>::value)
+                or static_cast<bool>(typename IsTriviallyRelocatable<T>::result())
+        >::__result;
+        using is_POD_type = typename __DataStructure_BooleanType<std::is_scalar<T>::value>::__result;
     };
     template <typename, bool>
     struct __DataStructure_IteratorTraitsAuxiliary {
@@ -428,9 +278,19 @@ namespace DataStructure {
         using constPointer = const valueType *;
         using iteratorTag = RandomAccessIterator;
     };
+    template <typename ...>
+    struct __DataStructure_voidType {
+        using type = void;
+    };
+    template <typename, typename = void>
+    struct __DataStructure_hasIteratorTag : std::false_type {};
+    template <typename Iterator>
+    struct __DataStructure_hasIteratorTag<
+            Iterator, typename __DataStructure_voidType<typename Iterator::iteratorTag>::type
+    > : std::true_type {};
     template <typename Iterator>
     using __DataStructure_IteratorTraits = __DataStructure_IteratorTraitsAuxiliary<Iterator,
-            static_cast<bool>(typename __DataStructure_TypeTraits<Iterator>::is_POD_type())
+            not __DataStructure_hasIteratorTag<Iterator>::value
     >;
     template <typename, bool>
     struct __DataStructure_NotIteratorInferringAuxiliary {
@@ -0,0 +1,472 @@
+#ifndef DATA_STRUCTURE_SMALL_VECTOR_HPP
+#define DATA_STRUCTURE_SMALL_VECTOR_HPP
+
+#include "Vector.hpp"
+
+namespace DataStructure {
+    template <typename T, unsigned long N>
+    class __DataStructure_InlineAllocator {
+        static_assert(N > 0, "The inline capacity of SmallVector should be greater than 0!");
+    private:
+        class BadPointer;
+    public:
+        using sizeType = unsigned long;
+        using differenceType = long;
+        using valueType = T;
+        using reference = valueType &;
+        using constReference = const valueType &;
+        using rightValueReference = valueType &&;
+        using pointer = valueType *;
+        using constPointer = const valueType *;
+    public:
+        using __DataStructure_isForwardAllocator = __DataStructure_trueType;
+        using __DataStructure_isReverseAllocator = __DataStructure_falseType;
+    private:
+        using heapAllocator = Allocator<T>;
+    private:
+        sizeType allocateSize;
+        pointer first;
+        pointer cursor;
+        alignas(valueType) unsigned char storage[sizeof(valueType) * N];
+    private:
+        static void destroy(void *, __DataStructure_falseType);
+        static void destroy(void *, __DataStructure_trueType) noexcept;
+        static void destroy(void *, void *, __DataStructure_falseType);
+        static void destroy(const void *, const void *, __DataStructure_trueType) noexcept;
+    public:
+        static void *operator new (sizeType);
+        static void operator delete (void *, sizeType) noexcept;
+        static void destroy(void *) noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
+        static void destroy(void *, const void *) noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
+    private:
+        pointer inlineStorage() noexcept;
+        bool isInline() const noexcept;
+        void copyRHS(const __DataStructure_InlineAllocator &);
+        void moveRHS(__DataStructure_InlineAllocator &) noexcept;
+        void free() noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
+        void reallocate(pointer);
+        void check(pointer) const;
+    public:
+        __DataStructure_InlineAllocator() noexcept;
+        __DataStructure_InlineAllocator(const __DataStructure_InlineAllocator &);
+        __DataStructure_InlineAllocator(__DataStructure_InlineAllocator &&) noexcept;
+        ~__DataStructure_InlineAllocator();
+    public:
+        __DataStructure_InlineAllocator &operator=(const __DataStructure_InlineAllocator &) &;
+        __DataStructure_InlineAllocator &operator=(__DataStructure_InlineAllocator &&) & noexcept;
+        bool operator==(const __DataStructure_InlineAllocator &) const;
+        bool operator!=(const __DataStructure_InlineAllocator &) const;
+        bool operator<(const __DataStructure_InlineAllocator &) const = delete;
+        bool operator<=(const __DataStructure_InlineAllocator &) const = delete;
+        bool operator>(const __DataStructure_InlineAllocator &) const = delete;
+        bool operator>=(const __DataStructure_InlineAllocator &) const = delete;
+        explicit operator bool() const noexcept;
+    public:
+        pointer allocate(sizeType = N) &;
+        pointer construct(pointer, constReference) & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+                    )
+                );
+        pointer construct(pointer, rightValueReference) & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+                    )
+                );
+        template <typename ...Args>
+        pointer construct(pointer, Args &&...) &;
+        pointer destroy(pointer) & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+        );
+        pointer destroy(pointer, constPointer) & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+        );
+        bool full() const & noexcept;
+        bool empty() const & noexcept;
+        sizeType size() const & noexcept;
+        sizeType capacity() const & noexcept;
+        sizeType reserve() const & noexcept;
+        pointer begin() const & noexcept;
+        constPointer getCursor() const & noexcept;
+        pointer &getCursor() & noexcept;
+        pointer end() const & noexcept;
+        pointer resize(sizeType) &;
+        pointer shrinkToFit() &;
+        void swap(__DataStructure_InlineAllocator &) noexcept;
+        pointer clear() & noexcept(
+                    static_cast<bool>(
+                            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+                    )
+                );
+    };
+    template <typename T, unsigned long N>
+    void swap(__DataStructure_InlineAllocator<T, N> &, __DataStructure_InlineAllocator<T, N> &) noexcept;
+
+    template <typename T, unsigned long N = 8>
+    using SmallVector = Vector<T, __DataStructure_InlineAllocator<T, N>>;
+}
+
+template <typename T, unsigned long N>
+class DataStructure::__DataStructure_InlineAllocator<T, N>::BadPointer : public DataStructure::RuntimeException {
+public:
+    explicit BadPointer(const char *error) : RuntimeException(error) {}
+    explicit BadPointer(const std::string &error) : RuntimeException(error) {}
+};
+
+template <typename T, unsigned long N>
+inline void DataStructure::swap(
+        __DataStructure_InlineAllocator<T, N> &lhs, __DataStructure_InlineAllocator<T, N> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::destroy(void *p, __DataStructure_falseType) {
+    reinterpret_cast<pointer>(p)->~valueType();
+}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::destroy(void *, __DataStructure_trueType) noexcept {}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::destroy(
+        const void *, const void *, __DataStructure_trueType) noexcept {}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::destroy(
+        void *first, void *last, __DataStructure_falseType) {
+    auto begin {reinterpret_cast<pointer>(first)};
+    auto cursor {reinterpret_cast<pointer>(last)};
+    while(cursor not_eq begin) {
+        (--cursor)->~valueType();
+    }
+}
+template <typename T, unsigned long N>
+inline typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::inlineStorage() noexcept {
+    return reinterpret_cast<pointer>(this->storage);
+}
+template <typename T, unsigned long N>
+inline bool DataStructure::__DataStructure_InlineAllocator<T, N>::isInline() const noexcept {
+    return this->first == reinterpret_cast<constPointer>(this->storage);
+}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::copyRHS(const __DataStructure_InlineAllocator &rhs) {
+    for(auto cursor {rhs.first}; cursor not_eq rhs.cursor;) {
+        new (this->cursor++) valueType(*cursor++);
+    }
+}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::moveRHS(__DataStructure_InlineAllocator &rhs) noexcept {
+    if(not rhs.isInline()) {
+        this->first = rhs.first;
+        this->cursor = rhs.cursor;
+        this->allocateSize = rhs.allocateSize;
+    }else {
+        this->first = this->cursor = this->inlineStorage();
+        this->allocateSize = N;
+        for(auto cursor {rhs.first}; cursor not_eq rhs.cursor;) {
+            new (this->cursor++) valueType(move(*cursor++));
+        }
+        __DataStructure_InlineAllocator::destroy(
+                rhs.first, rhs.cursor, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+        );
+    }
+    rhs.first = rhs.cursor = rhs.inlineStorage();
+    rhs.allocateSize = N;
+}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::free() noexcept(
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        ) {
+    __DataStructure_InlineAllocator::destroy(
+            this->first, this->cursor, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+    );
+    if(not this->isInline()) {
+        heapAllocator::operator delete (this->first, sizeof(valueType) * this->allocateSize);
+    }
+}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::reallocate(pointer newFirst) {
+    auto cursor {this->first};
+    for(auto i {0}; cursor not_eq this->cursor;) {
+        new (newFirst + i++) valueType(move(*cursor++));
+    }
+    const auto size {this->cursor - this->first};
+    this->free();
+    this->first = newFirst;
+    this->cursor = this->first + size;
+}
+template <typename T, unsigned long N>
+inline void DataStructure::__DataStructure_InlineAllocator<T, N>::check(pointer p) const {
+    if(p - this->first < 0 or p - this->end() >= 0) {
+        throw BadPointer("The pointer is not allocated by SmallVector!");
+    }
+}
+template <typename T, unsigned long N>
+void *DataStructure::__DataStructure_InlineAllocator<T, N>::operator new (sizeType size) {
+    return heapAllocator::operator new (size);
+}
+template <typename T, unsigned long N>
+void DataStructure::__DataStructure_InlineAllocator<T, N>::operator delete (void *p, sizeType size) noexcept {
+    heapAllocator::operator delete (p, size);
+}
+template <typename T, unsigned long N>
+void DataStructure::__DataStructure_InlineAllocator<T, N>::destroy(void *p) noexcept(
+            static_cast<bool>(
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+            )
+        ) {
+    __DataStructure_InlineAllocator::destroy(p,
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+               );
+}
+template <typename T, unsigned long N>
+void DataStructure::__DataStructure_InlineAllocator<T, N>::destroy(void *first, const void *last) noexcept(
+            static_cast<bool>(
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+            )
+        ) {
+    __DataStructure_InlineAllocator::destroy(first, const_cast<void *>(last),
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+               );
+}
+template <typename T, unsigned long N>
+DataStructure::__DataStructure_InlineAllocator<T, N>::__DataStructure_InlineAllocator() noexcept :
+        allocateSize {N}, first {this->inlineStorage()}, cursor {this->first} {}
+template <typename T, unsigned long N>
+DataStructure::__DataStructure_InlineAllocator<T, N>::__DataStructure_InlineAllocator(
+        const __DataStructure_InlineAllocator &rhs) : __DataStructure_InlineAllocator() {
+    this->allocate(rhs.size());
+    this->copyRHS(rhs);
+}
+template <typename T, unsigned long N>
+DataStructure::__DataStructure_InlineAllocator<T, N>::__DataStructure_InlineAllocator(
+        __DataStructure_InlineAllocator &&rhs) noexcept : __DataStructure_InlineAllocator() {
+    this->moveRHS(rhs);
+}
+template <typename T, unsigned long N>
+DataStructure::__DataStructure_InlineAllocator<T, N>::~__DataStructure_InlineAllocator() {
+    this->free();
+}
+template <typename T, unsigned long N>
+DataStructure::__DataStructure_InlineAllocator<T, N> &
+DataStructure::__DataStructure_InlineAllocator<T, N>::operator=(const __DataStructure_InlineAllocator &rhs) & {
+    if(&rhs == this) {
+        return *this;
+    }
+    this->clear();
+    this->allocate(rhs.size());
+    this->copyRHS(rhs);
+    return *this;
+}
+template <typename T, unsigned long N>
+DataStructure::__DataStructure_InlineAllocator<T, N> &
+DataStructure::__DataStructure_InlineAllocator<T, N>::operator=(__DataStructure_InlineAllocator &&rhs) & noexcept {
+    if(&rhs == this) {
+        return *this;
+    }
+    this->free();
+    this->moveRHS(rhs);
+    return *this;
+}
+template <typename T, unsigned long N>
+bool DataStructure::__DataStructure_InlineAllocator<T, N>::operator==(const __DataStructure_InlineAllocator &rhs) const {
+    if(this->size() not_eq rhs.size()) {
+        return false;
+    }
+    auto lhsCursor {this->first};
+    auto rhsCursor {rhs.first};
+    while(lhsCursor not_eq this->cursor) {
+        if(*lhsCursor++ not_eq *rhsCursor++) {
+            return false;
+        }
+    }
+    return true;
+}
+template <typename T, unsigned long N>
+bool DataStructure::__DataStructure_InlineAllocator<T, N>::operator!=(const __DataStructure_InlineAllocator &rhs) const {
+    return not(*this == rhs);
+}
+template <typename T, unsigned long N>
+DataStructure::__DataStructure_InlineAllocator<T, N>::operator bool() const noexcept {
+    return this->allocateSize not_eq static_cast<sizeType>(0);
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::allocate(sizeType size) & {
+    if(size <= this->allocateSize) {
+        return this->first;
+    }
+    return this->resize(size);
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::construct(pointer p, constReference value) & noexcept(
+            static_cast<bool>(
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+            )
+) {
+    this->check(p);
+    new (p) valueType(value);
+    if(p == this->cursor) {
+        ++this->cursor;
+    }
+    return this->cursor;
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::construct(pointer p, rightValueReference value) & noexcept(
+            static_cast<bool>(
+                    typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+            )
+) {
+    this->check(p);
+    new (p) valueType(move(value));
+    if(p == this->cursor) {
+        ++this->cursor;
+    }
+    return this->cursor;
+}
+template <typename T, unsigned long N>
+template <typename ...Args>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::construct(pointer p, Args &&...args) & {
+    return this->construct(p, valueType(std::forward<Args>(args)...));
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::destroy(pointer p) & noexcept(
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        ) {
+    __DataStructure_InlineAllocator::destroy(
+            p, typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+    );
+    if(this->cursor - 1 == p) {
+        --this->cursor;
+    }
+    return this->cursor;
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::destroy(pointer first, constPointer last) & noexcept(
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        ) {
+    __DataStructure_InlineAllocator::destroy(
+            first, const_cast<pointer>(last), typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+    );
+    if(this->cursor == last) {
+        this->cursor = first;
+    }
+    return this->cursor;
+}
+template <typename T, unsigned long N>
+bool DataStructure::__DataStructure_InlineAllocator<T, N>::full() const & noexcept {
+    return this->cursor - this->first == static_cast<differenceType>(this->allocateSize);
+}
+template <typename T, unsigned long N>
+bool DataStructure::__DataStructure_InlineAllocator<T, N>::empty() const & noexcept {
+    return this->cursor == this->first;
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::sizeType
+DataStructure::__DataStructure_InlineAllocator<T, N>::size() const & noexcept {
+    return static_cast<sizeType>(this->cursor - this->first);
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::sizeType
+DataStructure::__DataStructure_InlineAllocator<T, N>::capacity() const & noexcept {
+    return this->allocateSize;
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::sizeType
+DataStructure::__DataStructure_InlineAllocator<T, N>::reserve() const & noexcept {
+    return static_cast<sizeType>(this->end() - this->cursor);
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::begin() const & noexcept {
+    return this->first;
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::constPointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::getCursor() const & noexcept {
+    return this->cursor;
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer &
+DataStructure::__DataStructure_InlineAllocator<T, N>::getCursor() & noexcept {
+    return this->cursor;
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::end() const & noexcept {
+    return this->first + static_cast<differenceType>(this->allocateSize);
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::resize(sizeType size) & {
+    if(size <= this->allocateSize) {
+        return this->first;
+    }
+    this->reallocate(reinterpret_cast<pointer>(heapAllocator::operator new (sizeof(valueType) * size)));
+    this->allocateSize = size;
+    return this->first;
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::shrinkToFit() & {
+    if(this->isInline()) {
+        return this->first;
+    }
+    auto size {this->size()};
+    if(size <= N) {
+        this->reallocate(this->inlineStorage());
+        this->allocateSize = N;
+    }else if(size not_eq this->allocateSize) {
+        this->reallocate(reinterpret_cast<pointer>(heapAllocator::operator new (sizeof(valueType) * size)));
+        this->allocateSize = size;
+    }
+    return this->first;
+}
+template <typename T, unsigned long N>
+void DataStructure::__DataStructure_InlineAllocator<T, N>::swap(__DataStructure_InlineAllocator &rhs) noexcept {
+    if(not this->isInline() and not rhs.isInline()) {
+        using std::swap;
+        swap(this->allocateSize, rhs.allocateSize);
+        swap(this->first, rhs.first);
+        swap(this->cursor, rhs.cursor);
+        return;
+    }
+    __DataStructure_InlineAllocator temp {move(rhs)};
+    rhs = move(*this);
+    *this = move(temp);
+}
+template <typename T, unsigned long N>
+typename DataStructure::__DataStructure_InlineAllocator<T, N>::pointer
+DataStructure::__DataStructure_InlineAllocator<T, N>::clear() & noexcept(
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
+        ) {
+    if(this->empty()) {
+        return this->cursor;
+    }
+    __DataStructure_InlineAllocator::destroy(
+            this->first, this->cursor,
+            typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()
+    );
+    this->cursor = this->first;
+    return this->cursor;
+}
+
+#endif //DATA_STRUCTURE_SMALL_VECTOR_HPP
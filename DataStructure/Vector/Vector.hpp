@@ -1,11 +1,42 @@
 #ifndef DATA_STRUCTURE_VECTOR_HPP
 #define DATA_STRUCTURE_VECTOR_HPP
 
+#include <cstring>
 #include "../Allocator.hpp"
 #include "../Iterator.hpp"
 
 namespace DataStructure {
-    template <typename T, typename Alloc = Allocator<T>>
+    /*
+     * The growth policies of Vector. grow returns the new capacity from the current capacity, the number of elements
+     * the Vector has to hold and the size of an element, the result is never less than the required number.
+     */
+    struct DoublingGrowth {
+        static unsigned long grow(unsigned long capacity, unsigned long required, unsigned long) noexcept {
+            return capacity * 2 < required ? required : capacity * 2;
+        }
+    };
+    struct OneAndHalfGrowth {
+        static unsigned long grow(unsigned long capacity, unsigned long required, unsigned long) noexcept {
+            return capacity + capacity / 2 < required ? required : capacity + capacity / 2;
+        }
+    };
+    struct ExactGrowth {
+        static unsigned long grow(unsigned long, unsigned long required, unsigned long) noexcept {
+            return required;
+        }
+    };
+    template <unsigned long PageSize = 4096>
+    struct PageGrowth {
+        static_assert(PageSize > 0, "The page size of PageGrowth should be greater than 0!");
+        static unsigned long grow(unsigned long capacity, unsigned long required, unsigned long elementSize) noexcept {
+            const auto doubled {DoublingGrowth::grow(capacity, required, elementSize)};
+            if(doubled * elementSize < PageSize) {
+                return doubled;
+            }
+            return (doubled * elementSize + PageSize - 1) / PageSize * PageSize / elementSize;
+        }
+    };
+    template <typename T, typename Alloc = Allocator<T>, typename Growth = DoublingGrowth>
     class Vector final {
     public:
         using allocator = Alloc;
@@ -25,7 +56,14 @@ namespace DataStructure {
         allocator alloc;
     private:
         void checkAllocator(sizeType);
+        void countReallocation() const noexcept;
+        void moveBackward(pointer, sizeType, __DataStructure_trueType) noexcept;
+        void moveBackward(pointer, sizeType, __DataStructure_falseType);
+        pointer moveForward(pointer, pointer, __DataStructure_trueType) noexcept;
+        pointer moveForward(pointer, pointer, __DataStructure_falseType);
         pointer insertAuxiliary(differenceType, sizeType);
+        void defaultInitialize(sizeType, __DataStructure_trueType) noexcept;
+        void defaultInitialize(sizeType, __DataStructure_falseType);
     public:
         Vector();
         explicit Vector(const allocator &);
@@ -39,13 +77,13 @@ namespace DataStructure {
                     InputIterator, const allocator & = allocator()
               );
         Vector(std::initializer_list<valueType>, const allocator & = allocator());
-        Vector(const Vector &) = default;
+        Vector(const Vector &);
         Vector(const Vector &, const allocator &);
         Vector(Vector &&) noexcept = default;
         Vector(Vector &&, const allocator &);
-        ~Vector() = default;
+        ~Vector();
     public:
-        Vector &operator=(const Vector &) = default;
+        Vector &operator=(const Vector &);
         Vector &operator=(Vector &&) noexcept = default;
         Vector &operator=(std::initializer_list<valueType>);
         reference operator[](differenceType) &;
@@ -88,6 +126,8 @@ namespace DataStructure {
         sizeType reserve() const noexcept;
         iterator resize(sizeType);
         iterator shrinkToFit();
+        void resizeDefaultInit(sizeType);
+        void resizeUninitialized(sizeType);
         void clear() noexcept(
                 static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
         );
@@ -155,101 +195,202 @@ namespace DataStructure {
         allocator &getAllocator() & noexcept;
 #endif
     };
-    template <typename T, typename Alloc>
-    void swap(Vector<T, Alloc> &, Vector<T, Alloc> &) noexcept;
+    template <typename T, typename Alloc, typename Growth>
+    void swap(Vector<T, Alloc, Growth> &, Vector<T, Alloc, Growth> &) noexcept;
 }
 
-template <typename T, typename Alloc>
-void DataStructure::swap(Vector<T, Alloc> &lhs, Vector<T, Alloc> &rhs) noexcept {
+template <typename T, typename Alloc, typename Growth>
+void DataStructure::swap(Vector<T, Alloc, Growth> &lhs, Vector<T, Alloc, Growth> &rhs) noexcept {
     lhs.swap(rhs);
 }
 
-template <typename T, typename Allocator>
-inline void DataStructure::Vector<T, Allocator>::checkAllocator(sizeType size) {
-    while(this->alloc.reserve() < size) {
-        this->alloc.allocate(this->alloc.capacity() * 2);
+template <typename T, typename Allocator, typename Growth>
+inline void DataStructure::Vector<T, Allocator, Growth>::checkAllocator(sizeType size) {
+    if(this->alloc.reserve() >= size) {
+        return;
+    }
+    if(this->alloc.capacity()) {
+        this->countReallocation();
+    }else {
+        __DATA_STRUCTURE_STATISTICS_COUNT(Vector, ALLOCATE);
+    }
+    this->alloc.allocate(Growth::grow(this->alloc.capacity(), this->alloc.size() + size, sizeof(valueType)));
+}
+template <typename T, typename Allocator, typename Growth>
+inline void DataStructure::Vector<T, Allocator, Growth>::countReallocation() const noexcept {
+    __DATA_STRUCTURE_STATISTICS_COUNT(Vector, REALLOCATE);
+    if(not static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable())) {
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT_N(Vector, rightValueReference, this->size());
+        __DATA_STRUCTURE_STATISTICS_COUNT_N(Vector, DESTROY, this->size());
     }
 }
-template <typename T, typename Allocator>
-inline typename DataStructure::Vector<T, Allocator>::pointer
-DataStructure::Vector<T, Allocator>::insertAuxiliary(differenceType index, sizeType size) {
-    this->checkAllocator(size);
-    const auto insertPosition {this->alloc.begin() + index};
+template <typename T, typename Allocator, typename Growth>
+inline void DataStructure::Vector<T, Allocator, Growth>::moveBackward(
+        pointer position, sizeType size, __DataStructure_trueType
+) noexcept {
+    auto &cursor {this->alloc.getCursor()};
+    std::memmove(position + size, position, sizeof(valueType) * static_cast<sizeType>(cursor - position));
+    cursor += size;
+}
+template <typename T, typename Allocator, typename Growth>
+inline void DataStructure::Vector<T, Allocator, Growth>::moveBackward(
+        pointer position, sizeType size, __DataStructure_falseType
+) {
     const auto last {this->alloc.getCursor() + size};
     auto cursor {const_cast<pointer>(last - 1)};
     auto moveCursor {cursor - size};
-    while(moveCursor - insertPosition >= 0) {
+    while(moveCursor - position >= 0) {
         this->alloc.construct(cursor--, move(*moveCursor));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, rightValueReference);
         this->alloc.destroy(moveCursor--);
+        __DATA_STRUCTURE_STATISTICS_COUNT(Vector, DESTROY);
     }
     this->alloc.getCursor() = last;
+}
+template <typename T, typename Allocator, typename Growth>
+inline typename DataStructure::Vector<T, Allocator, Growth>::pointer
+DataStructure::Vector<T, Allocator, Growth>::moveForward(
+        pointer position, pointer cursor, __DataStructure_trueType
+) noexcept {
+    const auto size {static_cast<sizeType>(this->alloc.getCursor() - cursor)};
+    std::memmove(position, cursor, sizeof(valueType) * size);
+    return position + size;
+}
+template <typename T, typename Allocator, typename Growth>
+inline typename DataStructure::Vector<T, Allocator, Growth>::pointer
+DataStructure::Vector<T, Allocator, Growth>::moveForward(
+        pointer position, pointer cursor, __DataStructure_falseType
+) {
+    const auto allocCursor {this->alloc.getCursor()};
+    while(cursor < allocCursor) {
+        this->alloc.construct(position++, move(*cursor));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, rightValueReference);
+        this->alloc.destroy(cursor++);
+        __DATA_STRUCTURE_STATISTICS_COUNT(Vector, DESTROY);
+    }
+    return position;
+}
+template <typename T, typename Allocator, typename Growth>
+inline void DataStructure::Vector<T, Allocator, Growth>::defaultInitialize(
+        sizeType size, __DataStructure_trueType
+) noexcept {
+    this->alloc.getCursor() += size;
+}
+template <typename T, typename Allocator, typename Growth>
+inline void DataStructure::Vector<T, Allocator, Growth>::defaultInitialize(
+        sizeType size, __DataStructure_falseType
+) {
+    auto &cursor {this->alloc.getCursor()};
+    while(size--) {
+        new (cursor) valueType;
+        __DATA_STRUCTURE_STATISTICS_COUNT(Vector, CONSTRUCT);
+        ++cursor;
+    }
+}
+template <typename T, typename Allocator, typename Growth>
+inline typename DataStructure::Vector<T, Allocator, Growth>::pointer
+DataStructure::Vector<T, Allocator, Growth>::insertAuxiliary(differenceType index, sizeType size) {
+    this->checkAllocator(size);
+    const auto insertPosition {this->alloc.begin() + index};
+    this->moveBackward(
+            insertPosition, size, typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable()
+    );
     return insertPosition;
 };
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::Vector() : alloc() {
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector() : alloc() {
+    __DATA_STRUCTURE_STATISTICS_COUNT(Vector, ALLOCATE);
     this->alloc.allocate();
 }
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::Vector(const allocator &alloc) : alloc {alloc} {}
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::Vector(allocator &&alloc) noexcept : alloc {std::move(alloc)} {}
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::Vector(sizeType size, const allocator &alloc) :
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector(const allocator &alloc) : alloc {alloc} {}
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector(allocator &&alloc) noexcept : alloc {std::move(alloc)} {}
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector(sizeType size, const allocator &alloc) :
         Vector(size, valueType(), alloc) {}
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::Vector(sizeType size, constReference value, const allocator &alloc) :
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector(sizeType size, constReference value, const allocator &alloc) :
         alloc {alloc} {
     this->checkAllocator(size);
     while(size--) {
         this->alloc.construct(this->alloc.getCursor(), value);
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
     }
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 template <typename InputIterator,
         typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
 >
-DataStructure::Vector<T, Allocator>::Vector(
+DataStructure::Vector<T, Allocator, Growth>::Vector(
         typename __DataStructure_isInputIterator<InputIterator>::__result first,
         InputIterator last, const allocator &alloc
 ) : alloc(alloc) {
     this->checkAllocator(static_cast<sizeType>(IteratorDifference<InputIterator>()(first, last)));
     while(first not_eq last) {
         this->alloc.construct(this->alloc.getCursor(), static_cast<valueType>(*first++));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
     }
 }
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::Vector(
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector(
         std::initializer_list<valueType> list, const allocator &alloc
 ) :
        Vector(list.begin(), list.end(), alloc) {}
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::Vector(const Vector &rhs, const allocator &alloc) :
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector(const Vector &rhs) : alloc {rhs.alloc} {
+    __DATA_STRUCTURE_STATISTICS_COUNT(Vector, ALLOCATE);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT_N(Vector, constReference, this->size());
+}
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector(const Vector &rhs, const allocator &alloc) :
         Vector(rhs.begin(), rhs.end(), alloc) {}
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::Vector(Vector &&rhs, const allocator &alloc) : alloc {alloc} {
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::Vector(Vector &&rhs, const allocator &alloc) : alloc {alloc} {
     this->checkAllocator(rhs.size());
     for(auto &c : rhs) {
         alloc.construct(alloc.getCursor(), std::move(c));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, rightValueReference);
     }
 }
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator> &
-DataStructure::Vector<T, Allocator>::operator=(std::initializer_list<valueType> list) {
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::~Vector() {
+    if(this->alloc.begin()) {
+        __DATA_STRUCTURE_STATISTICS_COUNT_N(Vector, DESTROY, this->size());
+    }
+}
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth> &
+DataStructure::Vector<T, Allocator, Growth>::operator=(const Vector &rhs) {
+    if(&rhs == this) {
+        return *this;
+    }
+    if(this->alloc.begin()) {
+        __DATA_STRUCTURE_STATISTICS_COUNT_N(Vector, DESTROY, this->size());
+    }
+    this->alloc = rhs.alloc;
+    __DATA_STRUCTURE_STATISTICS_COUNT(Vector, ALLOCATE);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT_N(Vector, constReference, this->size());
+    return *this;
+}
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth> &
+DataStructure::Vector<T, Allocator, Growth>::operator=(std::initializer_list<valueType> list) {
     *this = Vector(list);
     return *this;
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::reference
-DataStructure::Vector<T, Allocator>::operator[](differenceType index) & {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::reference
+DataStructure::Vector<T, Allocator, Growth>::operator[](differenceType index) & {
     return index >= 0 ? *(alloc.begin() + index) : *(alloc.getCursor() + index);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::constReference
-DataStructure::Vector<T, Allocator>::operator[](differenceType index) const & {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::constReference
+DataStructure::Vector<T, Allocator, Growth>::operator[](differenceType index) const & {
     return const_cast<constReference>(const_cast<Vector *const>(this)->operator[](index));
 }
-template <typename T, typename Allocator>
-bool DataStructure::Vector<T, Allocator>::operator==(const Vector &rhs) const {
+template <typename T, typename Allocator, typename Growth>
+bool DataStructure::Vector<T, Allocator, Growth>::operator==(const Vector &rhs) const {
     const auto size {this->size()};
     return size == rhs.size() and [size](const Vector &lhs, const Vector &rhs) -> bool {
         for(auto i {0}; i < size; ++i) {
@@ -261,12 +402,12 @@ bool DataStructure::Vector<T, Allocator>::operator==(const Vector &rhs) const {
         return true;
     }(*this, rhs);
 }
-template <typename T, typename Allocator>
-bool DataStructure::Vector<T, Allocator>::operator!=(const Vector &rhs) const {
+template <typename T, typename Allocator, typename Growth>
+bool DataStructure::Vector<T, Allocator, Growth>::operator!=(const Vector &rhs) const {
     return not(*this == rhs);
 }
-template <typename T, typename Allocator>
-bool DataStructure::Vector<T, Allocator>::operator<(const Vector &rhs) const {
+template <typename T, typename Allocator, typename Growth>
+bool DataStructure::Vector<T, Allocator, Growth>::operator<(const Vector &rhs) const {
     const auto lhsSize {this->size()};
     const auto rhsSize {rhs.size()};
     if(lhsSize <= rhsSize) {
@@ -286,58 +427,59 @@ bool DataStructure::Vector<T, Allocator>::operator<(const Vector &rhs) const {
     }
     return false;
 }
-template <typename T, typename Allocator>
-bool DataStructure::Vector<T, Allocator>::operator<=(const Vector &rhs) const {
+template <typename T, typename Allocator, typename Growth>
+bool DataStructure::Vector<T, Allocator, Growth>::operator<=(const Vector &rhs) const {
     return *this < rhs or *this == rhs;
 }
-template <typename T, typename Allocator>
-bool DataStructure::Vector<T, Allocator>::operator>(const Vector &rhs) const {
+template <typename T, typename Allocator, typename Growth>
+bool DataStructure::Vector<T, Allocator, Growth>::operator>(const Vector &rhs) const {
     return not(*this <= rhs);
 }
-template <typename T, typename Allocator>
-bool DataStructure::Vector<T, Allocator>::operator>=(const Vector &rhs) const {
+template <typename T, typename Allocator, typename Growth>
+bool DataStructure::Vector<T, Allocator, Growth>::operator>=(const Vector &rhs) const {
     return not(*this < rhs);
 }
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator> DataStructure::Vector<T, Allocator>::operator+() const {
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth> DataStructure::Vector<T, Allocator, Growth>::operator+() const {
     auto temp {*this};
     for(auto &c : temp) {
         c = +c;
     }
     return temp;
 }
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator> DataStructure::Vector<T, Allocator>::operator-() const {
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth> DataStructure::Vector<T, Allocator, Growth>::operator-() const {
     auto temp {*this};
     for(auto &c : temp) {
         c = -c;
     }
     return temp;
 }
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::operator bool() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::operator bool() const noexcept {
     return not this->alloc.empty();
 }
-template <typename T, typename Allocator>
-DataStructure::Vector<T, Allocator>::operator pointer() const & noexcept {
+template <typename T, typename Allocator, typename Growth>
+DataStructure::Vector<T, Allocator, Growth>::operator pointer() const & noexcept {
     return const_cast<pointer>(this->alloc.begin());
 }
-template <typename T, typename Allocator>
-void DataStructure::Vector<T, Allocator>::assign(
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::assign(
         sizeType size, constReference value, const allocator &alloc
 ) {
     this->alloc = alloc;
     this->checkAllocator(size);
     while(size--) {
         this->alloc.construct(this->alloc.getCursor(), value);
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
     }
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 template <typename InputIterator,
         typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
 >
 void
-DataStructure::Vector<T, Allocator>::assign(
+DataStructure::Vector<T, Allocator, Growth>::assign(
         typename __DataStructure_isInputIterator<InputIterator>::__result first,
         InputIterator last, const allocator &alloc
 ) {
@@ -345,123 +487,153 @@ DataStructure::Vector<T, Allocator>::assign(
     this->checkAllocator(static_cast<sizeType>(IteratorDifference<InputIterator>()(first, last)));
     while(first not_eq last) {
         this->alloc.construct(this->alloc.getCursor(), static_cast<valueType>(*first++));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
     }
 }
-template <typename T, typename Allocator>
-void DataStructure::Vector<T, Allocator>::assign(
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::assign(
         std::initializer_list<valueType> list, const allocator &alloc
 ) {
     this->assign(list.begin(), list.end(), alloc);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::valueType
-DataStructure::Vector<T, Allocator>::at(differenceType index) const {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::valueType
+DataStructure::Vector<T, Allocator, Growth>::at(differenceType index) const {
     return (*this)[index];
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::valueType
-DataStructure::Vector<T, Allocator>::front() const {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::valueType
+DataStructure::Vector<T, Allocator, Growth>::front() const {
     return *this->alloc.begin();
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::valueType
-DataStructure::Vector<T, Allocator>::back() const {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::valueType
+DataStructure::Vector<T, Allocator, Growth>::back() const {
     return *(this->alloc.getCursor() - 1);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::pointer
-DataStructure::Vector<T, Allocator>::data() & noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::pointer
+DataStructure::Vector<T, Allocator, Growth>::data() & noexcept {
     return this->operator pointer();
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::constPointer
-DataStructure::Vector<T, Allocator>::data() const & noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::constPointer
+DataStructure::Vector<T, Allocator, Growth>::data() const & noexcept {
     return static_cast<pointer>(*this);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::begin() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::begin() const noexcept {
     return iterator(this->alloc.begin());
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::constIterator
-DataStructure::Vector<T, Allocator>::cbegin() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::constIterator
+DataStructure::Vector<T, Allocator, Growth>::cbegin() const noexcept {
     return constIterator(this->alloc.begin());
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::end() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::end() const noexcept {
     return iterator(const_cast<Vector *>(this)->alloc.getCursor());
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::constIterator
-DataStructure::Vector<T, Allocator>::cend() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::constIterator
+DataStructure::Vector<T, Allocator, Growth>::cend() const noexcept {
     return constIterator(this->alloc.getCursor());
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::reverseIterator
-DataStructure::Vector<T, Allocator>::rbegin() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::reverseIterator
+DataStructure::Vector<T, Allocator, Growth>::rbegin() const noexcept {
     return reverseIterator(this->end() - 1);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::constReverseIterator
-DataStructure::Vector<T, Allocator>::crbegin() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::constReverseIterator
+DataStructure::Vector<T, Allocator, Growth>::crbegin() const noexcept {
     return constReverseIterator(this->cend() - 1);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::reverseIterator
-DataStructure::Vector<T, Allocator>::rend() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::reverseIterator
+DataStructure::Vector<T, Allocator, Growth>::rend() const noexcept {
     return reverseIterator(this->begin() - 1);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::constReverseIterator
-DataStructure::Vector<T, Allocator>::crend() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::constReverseIterator
+DataStructure::Vector<T, Allocator, Growth>::crend() const noexcept {
     return constReverseIterator(this->cbegin() -1 );
 }
-template <typename T, typename Allocator>
-bool DataStructure::Vector<T, Allocator>::empty() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+bool DataStructure::Vector<T, Allocator, Growth>::empty() const noexcept {
     return this->alloc.empty();
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::sizeType
-DataStructure::Vector<T, Allocator>::size() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::sizeType
+DataStructure::Vector<T, Allocator, Growth>::size() const noexcept {
     return this->alloc.size();
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::sizeType
-DataStructure::Vector<T, Allocator>::capacity() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::sizeType
+DataStructure::Vector<T, Allocator, Growth>::capacity() const noexcept {
     return this->alloc.capacity();
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::sizeType
-DataStructure::Vector<T, Allocator>::reserve() const noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::sizeType
+DataStructure::Vector<T, Allocator, Growth>::reserve() const noexcept {
     return this->alloc.reserve();
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::resize(sizeType size) {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::resize(sizeType size) {
+    if(size > this->alloc.capacity()) {
+        this->countReallocation();
+    }
     return iterator(this->alloc.resize(size));
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::shrinkToFit() {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::shrinkToFit() {
+    if(this->alloc.size() not_eq this->alloc.capacity()) {
+        this->countReallocation();
+    }
     return iterator(this->alloc.shrinkToFit());
 }
-template <typename T, typename Allocator>
-void DataStructure::Vector<T, Allocator>::clear() noexcept(
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::resizeDefaultInit(sizeType size) {
+    const auto oldSize {this->size()};
+    if(size <= oldSize) {
+        __DATA_STRUCTURE_STATISTICS_COUNT_N(Vector, DESTROY, oldSize - size);
+        this->alloc.destroy(this->alloc.begin() + size, this->alloc.getCursor());
+        return;
+    }
+    this->checkAllocator(size - oldSize);
+    this->defaultInitialize(
+            size - oldSize, typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()
+    );
+}
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::resizeUninitialized(sizeType size) {
+    static_assert(static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDefaultConstructor()) and
+            static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor()),
+            "resizeUninitialized requires a type with trivial default constructor and trivial destructor!");
+    this->resizeDefaultInit(size);
+}
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::clear() noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
+    __DATA_STRUCTURE_STATISTICS_COUNT_N(Vector, DESTROY, this->alloc.size());
     this->alloc.destroy(this->alloc.begin(), this->alloc.getCursor());
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::insert(differenceType index, constReference value, sizeType size) {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::insert(differenceType index, constReference value, sizeType size) {
     if(not size) {
         return iterator(this->alloc.begin() + index);
     }
     if(index == this->size()) {
+        this->checkAllocator(size);
         while(size--) {
-            this->pushBack(value);
+            this->alloc.construct(this->alloc.getCursor(), value);
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
         }
         return iterator(this->alloc.begin() + index);
     }
@@ -469,12 +641,13 @@ DataStructure::Vector<T, Allocator>::insert(differenceType index, constReference
     auto cursor {insertPosition};
     while(size--) {
         this->alloc.construct(cursor++, value);
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
     }
     return iterator(insertPosition);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::insert(differenceType index, rightValueReference value) {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::insert(differenceType index, rightValueReference value) {
     if(index == this->size()) {
         this->pushBack(move(value));
         return iterator(this->alloc.begin() + index);
@@ -482,72 +655,76 @@ DataStructure::Vector<T, Allocator>::insert(differenceType index, rightValueRefe
     auto insertPosition {this->insertAuxiliary(index, 1)};
     auto cursor {insertPosition};
     this->alloc.construct(cursor, move(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, rightValueReference);
     return iterator(insertPosition);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::insert(constIterator position, constReference value, sizeType size) {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::insert(constIterator position, constReference value, sizeType size) {
     return this->insert(position - constIterator(this->alloc.begin()), value, size);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::insert(constIterator position, rightValueReference value) {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::insert(constIterator position, rightValueReference value) {
     return this->insert(position - constIterator(this->alloc.begin()), move(value));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 template <typename InputIterator,
         typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
 >
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::insert(
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::insert(
         differenceType index, typename __DataStructure_isInputIterator<InputIterator>::__result first,
         InputIterator last
 ) {
     if(first == last) {
         return iterator(this->alloc.begin() + index);
     }
+    auto size {static_cast<sizeType>(IteratorDifference<InputIterator>()(first, last))};
     if(index == this->size()) {
+        this->checkAllocator(size);
         while(first not_eq last) {
-            this->pushBack(static_cast<valueType>(*first++));
+            this->alloc.construct(this->alloc.getCursor(), static_cast<valueType>(*first++));
+            __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
         }
         return iterator(this->alloc.begin() + index);
     }
-    auto size {static_cast<sizeType>(IteratorDifference<InputIterator>()(first, last))};
     auto insertPosition {this->insertAuxiliary(index, size)};
     auto cursor {insertPosition};
-    while(--size) {
-        this->Alloc.construct(cursor++, static_cast<valueType>(*first++));
+    while(size--) {
+        this->alloc.construct(cursor++, static_cast<valueType>(*first++));
+        __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
     }
     return iterator(insertPosition);
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 template <typename InputIterator,
         typename DataStructure::__DataStructure_isInputIterator<InputIterator>::__result *
 >
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::insert(
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::insert(
         constIterator position, typename __DataStructure_isInputIterator<InputIterator>::__result first,
         InputIterator last
 ) {
     return this->insert(position - constIterator(this->alloc.begin()), first, last);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::insert(
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::insert(
         differenceType index, std::initializer_list<valueType> list
 ) {
     return this->insert(index, list.begin(), list.end());
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::insert(
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::insert(
         constIterator position, std::initializer_list<valueType> list
 ) {
     return this->insert(position, list.begin(), list.end());
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::erase(differenceType index, sizeType size) noexcept(
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::erase(differenceType index, sizeType size) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
     auto erasePosition {this->alloc.begin() + index};
@@ -560,56 +737,55 @@ DataStructure::Vector<T, Allocator>::erase(differenceType index, sizeType size)
         }
         return iterator(erasePosition);
     }
-    const auto returnPosition {erasePosition};
-    auto cursor {erasePosition + size};
+    const auto cursor {erasePosition + size};
+    __DATA_STRUCTURE_STATISTICS_COUNT_N(Vector, DESTROY, size);
     this->alloc.destroy(erasePosition, cursor);
-    auto &allocCursor {this->alloc.getCursor()};
-    while(cursor < allocCursor) {
-        this->alloc.construct(erasePosition++, move(*cursor));
-        this->alloc.destroy(cursor++);
-    }
-    allocCursor = erasePosition;
-    return iterator(returnPosition);
-}
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::erase(constIterator position, sizeType size) noexcept(
+    this->alloc.getCursor() = this->moveForward(
+            erasePosition, cursor, typename __DataStructure_TypeTraits<valueType>::isTriviallyRelocatable()
+    );
+    return iterator(erasePosition);
+}
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::erase(constIterator position, sizeType size) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
     return this->erase(position - constIterator(this->alloc.begin()), size);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::erase(constIterator first, constIterator last) noexcept(
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::erase(constIterator first, constIterator last) noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
     return this->erase(first, last - first);
 }
-template <typename T, typename Allocator>
-void DataStructure::Vector<T, Allocator>::pushBack(constReference value) {
-    this->checkAllocator(this->size() + 1);
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::pushBack(constReference value) {
+    this->checkAllocator(1);
     this->alloc.construct(this->alloc.getCursor(), value);
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, constReference);
 }
-template <typename T, typename Allocator>
-void DataStructure::Vector<T, Allocator>::pushBack(rightValueReference value) {
-    this->checkAllocator(this->size() + 1);
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::pushBack(rightValueReference value) {
+    this->checkAllocator(1);
     this->alloc.construct(this->alloc.getCursor(), move(value));
+    __DATA_STRUCTURE_STATISTICS_CONSTRUCT(Vector, rightValueReference);
 }
-template <typename T, typename Allocator>
-void DataStructure::Vector<T, Allocator>::pushFront(constReference value) {
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::pushFront(constReference value) {
     this->insert(0, value);
 }
-template <typename T, typename Allocator>
-void DataStructure::Vector<T, Allocator>::pushFront(rightValueReference value) {
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::pushFront(rightValueReference value) {
     this->insert(0, move(value));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 #ifdef POP_GET_OBJECT
-typename DataStructure::Vector<T, Allocator>::valueType
+typename DataStructure::Vector<T, Allocator, Growth>::valueType
 #else
 void
 #endif
-DataStructure::Vector<T, Allocator>::popBack() noexcept(
+DataStructure::Vector<T, Allocator, Growth>::popBack() noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
     if(this->empty()) {
@@ -622,17 +798,18 @@ DataStructure::Vector<T, Allocator>::popBack() noexcept(
     auto value {move(*(this->alloc.getCursor() - 1))};
 #endif
     this->alloc.destroy(this->alloc.getCursor() - 1);
+    __DATA_STRUCTURE_STATISTICS_COUNT(Vector, DESTROY);
 #ifdef POP_GET_OBJECT
     return value
 #endif
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 #ifdef POP_GET_OBJECT
-typename DataStructure::Vector<T, Allocator>::valueType
+typename DataStructure::Vector<T, Allocator, Growth>::valueType
 #else
 void
 #endif
-DataStructure::Vector<T, Allocator>::popFront()noexcept(
+DataStructure::Vector<T, Allocator, Growth>::popFront()noexcept(
         static_cast<bool>(typename __DataStructure_TypeTraits<valueType>::hasTrivialDestructor())
 ) {
     if(this->empty()) {
@@ -649,40 +826,41 @@ DataStructure::Vector<T, Allocator>::popFront()noexcept(
     return value;
 #endif
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 template <typename ...Args>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::emplace(differenceType index, Args &&...args) {
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::emplace(differenceType index, Args &&...args) {
     return this->insert(index, valueType(std::forward<Args>(args)...));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 template <typename ...Args>
-typename DataStructure::Vector<T, Allocator>::iterator
-DataStructure::Vector<T, Allocator>::emplace(constIterator position, Args &&...args) {
+typename DataStructure::Vector<T, Allocator, Growth>::iterator
+DataStructure::Vector<T, Allocator, Growth>::emplace(constIterator position, Args &&...args) {
     return this->insert(position, valueType(std::forward<Args>(args)...));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 template <typename ...Args>
-void DataStructure::Vector<T, Allocator>::emplaceBack(Args &&...args) {
+void DataStructure::Vector<T, Allocator, Growth>::emplaceBack(Args &&...args) {
     this->pushBack(valueType(std::forward<Args>(args)...));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Growth>
 template <typename ...Args>
-void DataStructure::Vector<T, Allocator>::emplaceFront(Args &&...args) {
+void DataStructure::Vector<T, Allocator, Growth>::emplaceFront(Args &&...args) {
     this->pushFront(valueType(std::forward<Args>(args)...));
 }
-template <typename T, typename Allocator>
-void DataStructure::Vector<T, Allocator>::swap(Vector &rhs) noexcept {
+template <typename T, typename Allocator, typename Growth>
+void DataStructure::Vector<T, Allocator, Growth>::swap(Vector &rhs) noexcept {
     this->alloc.swap(rhs.alloc);
 }
-template <typename T, typename Allocator>
-typename DataStructure::Vector<T, Allocator>::allocator
-DataStructure::Vector<T, Allocator>::getAllocator() const & {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::allocator
+DataStructure::Vector<T, Allocator, Growth>::getAllocator() const & {
     return this->alloc;
 }
 #ifdef DEBUG_DATA_STRUCTURE_FOR_VECTOR
-typename DataStructure::Vector<T, Allocator>::allocator &
-DataStructure::Vector<T, Allocator>::getAllocator() & noexcept {
+template <typename T, typename Allocator, typename Growth>
+typename DataStructure::Vector<T, Allocator, Growth>::allocator &
+DataStructure::Vector<T, Allocator, Growth>::getAllocator() & noexcept {
     return this->alloc;
 }
 #endif
@@ -0,0 +1,46 @@
+#define STATISTICS_DATA_STRUCTURE
+#include <cassert>
+#include <iostream>
+#include <utility>
+#include "../DataStructure/Vector/Vector.hpp"
+
+namespace {
+    /*
+     * The element with its own copy and move constructors, so that it is never relocated by memcpy or memmove.
+     */
+    struct Element {
+        int value;
+        Element(int value = 0) : value {value} {}
+        Element(const Element &rhs) : value {rhs.value} {}
+        Element(Element &&rhs) noexcept : value {rhs.value} {}
+        Element &operator=(const Element &) = default;
+        ~Element() {}
+    };
+    using VectorStatistics = DataStructure::Statistics<DataStructure::Vector<Element>>;
+
+    void copiedVectorBalance() {
+        VectorStatistics::reset();
+        {
+            DataStructure::Vector<Element> first(10, Element(1));
+            DataStructure::Vector<Element> second(10, Element(2));
+            DataStructure::Vector<Element> cleared(10, Element(3));
+            cleared.clear();
+            DataStructure::Vector<Element> copied(first);
+            second = first;
+            DataStructure::Vector<Element> moved(std::move(copied));
+            auto snapshot {VectorStatistics::snapshot()};
+            assert(snapshot.construct == 50);
+            assert(snapshot.copy == 50);
+            assert(snapshot.destroy == 20);
+            assert(snapshot.allocate == 5);
+        }
+        auto snapshot {VectorStatistics::snapshot()};
+        assert(snapshot.construct == snapshot.destroy);
+        assert(snapshot.move == 0);
+    }
+}
+
+int main() {
+    copiedVectorBalance();
+    std::cout << "Statistics tests passed." << std::endl;
+}